@@ -0,0 +1,15 @@
+#ifndef BENCH_INCLUDE_ALLOCATION_COUNTER_H_
+#define BENCH_INCLUDE_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace KinovaZED::Bench {
+
+/**
+ * Get the number of heap allocations made through the global operator new since the program started
+ */
+auto allocationCount() noexcept -> std::size_t;
+
+} // namespace KinovaZED::Bench
+
+#endif
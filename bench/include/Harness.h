@@ -0,0 +1,134 @@
+#ifndef BENCH_INCLUDE_HARNESS_H_
+#define BENCH_INCLUDE_HARNESS_H_
+
+#include "AllocationCounter.h"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace KinovaZED::Bench {
+
+/**
+ * Prevent the compiler from optimizing away the computation of the given value
+ */
+template<typename ValueType>
+auto keep(ValueType const &value) -> void {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static_cast<void>(*static_cast<ValueType const volatile *>(&value));
+#endif
+}
+
+struct Configuration {
+	/**
+	 * The number of untimed repetitions before the measurement starts
+	 */
+	std::size_t warmups{3};
+
+	/**
+	 * The number of timed repetitions, each of which yields one sample
+	 */
+	std::size_t repetitions{31};
+
+	/**
+	 * The minimal duration of a single repetition
+	 *
+	 * Fast operations are run in batches of the same size for every repetition, so that the resolution of the clock
+	 * does not dominate the samples.
+	 */
+	std::chrono::nanoseconds minimumRepetitionTime{std::chrono::milliseconds{5}};
+
+	/**
+	 * Only run the benchmarks whose name contains this string
+	 */
+	std::string filter{};
+};
+
+struct Statistics {
+	std::string name;
+	std::size_t repetitions;
+	std::size_t operationsPerRepetition;
+	double medianNanoseconds;
+	double p99Nanoseconds;
+	double minimumNanoseconds;
+	double allocationsPerOperation;
+};
+
+struct Harness {
+	explicit Harness(Configuration configuration);
+
+	/**
+	 * Measure the given operation
+	 *
+	 * The operation is called with the index of the call in the current repetition, which allows it to alternate
+	 * between inputs.
+	 */
+	template<typename Operation>
+	auto run(std::string const &name, Operation &&operation) -> void {
+		if (!isSelected(name)) {
+			return;
+		}
+
+		auto const batch = [&](std::size_t operations) {
+			auto const start = std::chrono::steady_clock::now();
+			for (auto index = std::size_t{}; index < operations; ++index) {
+				operation(index);
+			}
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+		};
+
+		auto operations = std::size_t{1};
+		while (batch(operations) < configuration.minimumRepetitionTime) {
+			operations *= 2;
+		}
+
+		for (auto warmup = std::size_t{}; warmup < configuration.warmups; ++warmup) {
+			batch(operations);
+		}
+
+		auto samples = std::vector<std::chrono::nanoseconds>{};
+		samples.reserve(configuration.repetitions);
+		auto const allocationsBefore = allocationCount();
+		for (auto repetition = std::size_t{}; repetition < configuration.repetitions; ++repetition) {
+			samples.push_back(batch(operations));
+		}
+		auto const allocations = allocationCount() - allocationsBefore;
+
+		record(name, operations, std::move(samples), allocations);
+	}
+
+	auto getResults() const -> std::vector<Statistics> const &;
+
+  private:
+	auto isSelected(std::string const &name) const -> bool;
+	auto record(std::string const &name,
+	            std::size_t operations,
+	            std::vector<std::chrono::nanoseconds> samples,
+	            std::size_t allocations) -> void;
+
+	Configuration configuration;
+	std::vector<Statistics> results{};
+};
+
+/**
+ * Write the results as a human readable table
+ */
+auto writeText(std::vector<Statistics> const &results, std::ostream &out) -> void;
+
+/**
+ * Write the results, together with a description of the platform they were measured on, as a JSON document
+ */
+auto writeJson(std::vector<Statistics> const &results, Configuration const &configuration, std::ostream &out) -> void;
+
+auto to_json(nlohmann::json &output, Statistics const &statistics) -> void;
+
+} // namespace KinovaZED::Bench
+
+#endif
@@ -0,0 +1,36 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> allocations{};
+
+} // namespace
+
+namespace KinovaZED::Bench {
+
+auto allocationCount() noexcept -> std::size_t {
+	return allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace KinovaZED::Bench
+
+auto operator new(std::size_t size) -> void * {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (auto memory = std::malloc(size ? size : 1)) {
+		return memory;
+	}
+	throw std::bad_alloc{};
+}
+
+auto operator delete(void *memory) noexcept -> void {
+	std::free(memory);
+}
+
+auto operator delete(void *memory, std::size_t) noexcept -> void {
+	std::free(memory);
+}
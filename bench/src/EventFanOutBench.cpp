@@ -0,0 +1,85 @@
+#include "support/SubscriberList.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+auto constexpr eventCount = std::size_t{100000};
+auto constexpr subscriberCounts = std::array{std::size_t{1}, std::size_t{8}, std::size_t{64}, std::size_t{512}};
+
+struct Subscriber {
+	auto onEvent(std::uint64_t value) -> void {
+		sum += value;
+	}
+
+	std::uint64_t sum{};
+};
+
+/**
+ * Measure the average time it takes to deliver one event to all subscribers
+ */
+template<typename Fire>
+auto measure(Fire &&fire) -> std::chrono::duration<double, std::nano> {
+	auto const start = std::chrono::steady_clock::now();
+	for (auto event = std::uint64_t{}; event < eventCount; ++event) {
+		fire(event);
+	}
+	return (std::chrono::steady_clock::now() - start) / static_cast<double>(eventCount);
+}
+
+auto report(std::string const &name, std::size_t subscribers, std::chrono::duration<double, std::nano> perEvent) {
+	std::cout << name << " subscribers=" << subscribers << " ns/event=" << perEvent.count()
+	          << " ns/delivery=" << perEvent.count() / static_cast<double>(subscribers) << '\n';
+}
+
+} // namespace
+
+/**
+ * Compare event fan-out through a plain set of shared pointers, which copies every pointer it delivers to, with the
+ * copy-on-write subscriber list used by the actors and command interfaces
+ *
+ * The plain set is not safe to change while it is being notified. The mutex-guarded set is the thread-safe baseline
+ * the subscriber list has to beat.
+ */
+int main() {
+	auto checksum = std::uint64_t{};
+
+	for (auto count : subscriberCounts) {
+		auto subscribers = std::vector<std::shared_ptr<Subscriber>>(count);
+		std::generate(begin(subscribers), end(subscribers), [] { return std::make_shared<Subscriber>(); });
+
+		auto set = std::set<std::shared_ptr<Subscriber>>{cbegin(subscribers), cend(subscribers)};
+		auto fireThroughSet = [&](auto event) {
+			std::for_each(begin(set), end(set), [&](auto subscriber) { subscriber->onEvent(event); });
+		};
+		report("std::set      ", count, measure(fireThroughSet));
+
+		auto setMutex = std::mutex{};
+		auto fireThroughLockedSet = [&](auto event) {
+			auto lock = std::lock_guard{setMutex};
+			std::for_each(begin(set), end(set), [&](auto subscriber) { subscriber->onEvent(event); });
+		};
+		report("locked set    ", count, measure(fireThroughLockedSet));
+
+		auto list = KinovaZED::SubscriberList<Subscriber>{};
+		std::for_each(cbegin(subscribers), cend(subscribers), [&](auto const &subscriber) { list.add(subscriber); });
+		auto fireThroughList = [&](auto event) { list.forEach([&](auto &subscriber) { subscriber.onEvent(event); }); };
+		report("SubscriberList", count, measure(fireThroughList));
+
+		for (auto const &subscriber : subscribers) {
+			checksum += subscriber->sum;
+		}
+	}
+
+	std::cout << "checksum=" << checksum << '\n';
+}
@@ -0,0 +1,141 @@
+#include "Harness.h"
+
+#include "math/Matrix.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace KinovaZED::Bench {
+
+namespace {
+
+/**
+ * Get the given percentile of the sorted samples, using the nearest-rank method
+ */
+auto percentile(std::vector<double> const &sorted, double rank) -> double {
+	auto const position = static_cast<std::size_t>(std::ceil(rank / 100.0 * static_cast<double>(sorted.size())));
+	return sorted[std::clamp(position, std::size_t{1}, sorted.size()) - 1];
+}
+
+auto median(std::vector<double> const &sorted) -> double {
+	auto const middle = sorted.size() / 2;
+	return sorted.size() % 2 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+}
+
+auto architecture() -> std::string {
+#if defined(__aarch64__)
+	return "aarch64";
+#elif defined(__arm__)
+	return "arm";
+#elif defined(__x86_64__)
+	return "x86_64";
+#elif defined(__i386__)
+	return "x86";
+#else
+	return "unknown";
+#endif
+}
+
+auto compiler() -> std::string {
+#if defined(__clang__)
+	return "clang " __clang_version__;
+#elif defined(__GNUC__)
+	return "gcc " __VERSION__;
+#else
+	return "unknown";
+#endif
+}
+
+} // namespace
+
+Harness::Harness(Configuration configuration)
+    : configuration{std::move(configuration)} {
+}
+
+auto Harness::getResults() const -> std::vector<Statistics> const & {
+	return results;
+}
+
+auto Harness::isSelected(std::string const &name) const -> bool {
+	return name.find(configuration.filter) != std::string::npos;
+}
+
+auto Harness::record(std::string const &name,
+                     std::size_t operations,
+                     std::vector<std::chrono::nanoseconds> samples,
+                     std::size_t allocations) -> void {
+	auto perOperation = std::vector<double>(samples.size());
+	std::transform(cbegin(samples), cend(samples), begin(perOperation), [&](auto sample) {
+		return static_cast<double>(sample.count()) / static_cast<double>(operations);
+	});
+	std::sort(begin(perOperation), end(perOperation));
+
+	auto const totalOperations = static_cast<double>(operations * samples.size());
+	results.push_back({
+	    name,
+	    samples.size(),
+	    operations,
+	    median(perOperation),
+	    percentile(perOperation, 99.0),
+	    perOperation.front(),
+	    static_cast<double>(allocations) / totalOperations,
+	});
+}
+
+auto writeText(std::vector<Statistics> const &results, std::ostream &out) -> void {
+	auto const nameWidth = std::max_element(cbegin(results), cend(results), [](auto const &lhs, auto const &rhs) {
+		return lhs.name.size() < rhs.name.size();
+	});
+	auto const width = nameWidth == cend(results) ? 0 : static_cast<int>(nameWidth->name.size());
+
+	auto const flags = out.flags();
+	out << std::fixed << std::setprecision(2);
+	for (auto const &result : results) {
+		out << std::left << std::setw(width) << result.name << std::right;
+		out << " median=" << std::setw(12) << result.medianNanoseconds << " ns/op";
+		out << " p99=" << std::setw(12) << result.p99Nanoseconds << " ns/op";
+		out << " min=" << std::setw(12) << result.minimumNanoseconds << " ns/op";
+		out << " allocations/op=" << result.allocationsPerOperation;
+		out << " (" << result.repetitions << " x " << result.operationsPerRepetition << " ops)\n";
+	}
+	out.flags(flags);
+}
+
+auto writeJson(std::vector<Statistics> const &results, Configuration const &configuration, std::ostream &out) -> void {
+	auto const document = nlohmann::json{
+	    {"context",
+	     {
+	         {"architecture", architecture()},
+	         {"compiler", compiler()},
+	         {"vectorizedKernels", Kernels::isVectorized},
+	         {"warmups", configuration.warmups},
+	         {"repetitions", configuration.repetitions},
+	         {"minimumRepetitionTimeNanoseconds", configuration.minimumRepetitionTime.count()},
+	     }},
+	    {"benchmarks", results},
+	};
+	out << document.dump(2) << '\n';
+}
+
+auto to_json(nlohmann::json &output, Statistics const &statistics) -> void {
+	output = nlohmann::json{
+	    {"name", statistics.name},
+	    {"repetitions", statistics.repetitions},
+	    {"operationsPerRepetition", statistics.operationsPerRepetition},
+	    {"medianNanoseconds", statistics.medianNanoseconds},
+	    {"p99Nanoseconds", statistics.p99Nanoseconds},
+	    {"minimumNanoseconds", statistics.minimumNanoseconds},
+	    {"allocationsPerOperation", statistics.allocationsPerOperation},
+	};
+}
+
+} // namespace KinovaZED::Bench
@@ -0,0 +1,272 @@
+#include "Harness.h"
+
+#include "control/Objective.h"
+#include "hw/Coordinates.h"
+#include "hw/Origin.h"
+#include "math/Matrix.h"
+#include "math/Pose.h"
+#include "support/Logging.h"
+
+#include <lyra/cli_parser.hpp>
+#include <lyra/help.hpp>
+#include <lyra/opt.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using KinovaZED::BasicPose;
+using KinovaZED::Bench::Harness;
+using KinovaZED::Bench::keep;
+using KinovaZED::Control::Objective;
+using KinovaZED::Hw::BasicOrigin;
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::Origin;
+
+namespace {
+
+auto constexpr waypoints = std::size_t{1000};
+auto constexpr chainLength = std::size_t{1000};
+
+Coordinates const openDoorOrigin{0.212972f, -0.271539f, 0.491391f, 1.545f, 1.047f, 0.062f};
+Coordinates const handleOrigin{0.120f, -0.723f, 0.551f, 1.491f, -0.066f, 0.002f};
+Coordinates const firstWaypoint{-0.003f, 0.008f, 0.0f, -0.027f, -0.008f, 0.713f};
+Coordinates const secondWaypoint{-0.033f, 0.015f, -0.197f, -0.06f, 0.192f, 0.598f};
+
+auto makeObjective(KinovaZED::Logger logger) -> Objective {
+	auto sequence = std::vector<Coordinates>{};
+	for (auto index = std::size_t{}; index < waypoints; ++index) {
+		auto const offset = static_cast<float>(index % 100) * 0.001f;
+		sequence.push_back({-0.003f + offset, 0.008f, 0.0f, -0.027f, -0.008f, 0.713f});
+	}
+	return {Objective::Id::OpenDoor, openDoorOrigin, sequence, true, logger};
+}
+
+/**
+ * Benchmark the matrix helpers in math/Matrix.h
+ *
+ * Every benchmark alternates between two inputs, so that the compiler cannot hoist the computation out of the loop.
+ */
+auto benchmarkMatrices(Harness &harness) -> void {
+	auto const origins = std::array{Origin{openDoorOrigin}, Origin{handleOrigin}};
+	auto const matrices = std::array{origins[0].getTransformationMatrix(), origins[1].getTransformationMatrix()};
+	auto const rotations = std::array{KinovaZED::rotationOf(matrices[0]), KinovaZED::rotationOf(matrices[1])};
+	auto const angles = std::array{KinovaZED::Vec3{openDoorOrigin.pitch, openDoorOrigin.yaw, openDoorOrigin.roll},
+	                               KinovaZED::Vec3{handleOrigin.pitch, handleOrigin.yaw, handleOrigin.roll}};
+	auto const points = std::array{firstWaypoint, secondWaypoint};
+
+	harness.run("matMultiply (4x4)", [&](auto index) {
+		keep(KinovaZED::matMultiply(matrices[index % 2], matrices[0]));
+	});
+
+	harness.run("matMultiply (3x3)", [&](auto index) {
+		keep(KinovaZED::matMultiply(rotations[index % 2], rotations[0]));
+	});
+
+	harness.run("rotMatrix", [&](auto index) { keep(KinovaZED::rotMatrix(angles[index % 2].data())); });
+
+	harness.run("getEulerAngles", [&](auto index) { keep(KinovaZED::getEulerAngles(rotations[index % 2])); });
+
+	harness.run("coordTransform", [&](auto index) {
+		keep(KinovaZED::coordTransform(points[index % 2], matrices[0]));
+	});
+
+	harness.run("Kernels::compose", [&](auto index) {
+		keep(KinovaZED::Kernels::compose(matrices[index % 2], matrices[0]));
+	});
+
+	harness.run("Kernels::invertRigid", [&](auto index) {
+		keep(KinovaZED::Kernels::invertRigid(matrices[index % 2]));
+	});
+}
+
+/**
+ * Benchmark the scalar and the vectorized variants of the transformation kernels in math/Matrix.h side by side
+ *
+ * Without SIMD support, the vectorized variants fall back to the scalar ones.
+ */
+auto benchmarkKernels(Harness &harness) -> void {
+	auto const origins = std::array{Origin{openDoorOrigin}, Origin{handleOrigin}};
+	auto const matrices = std::array{origins[0].getTransformationMatrix(), origins[1].getTransformationMatrix()};
+
+	harness.run("Kernels::Scalar::compose", [&](auto index) {
+		keep(KinovaZED::Kernels::Scalar::compose(matrices[index % 2], matrices[0]));
+	});
+
+	harness.run("Kernels::Vectorized::compose", [&](auto index) {
+		keep(KinovaZED::Kernels::Vectorized::compose(matrices[index % 2], matrices[0]));
+	});
+
+	harness.run("Kernels::Scalar::invertRigid", [&](auto index) {
+		keep(KinovaZED::Kernels::Scalar::invertRigid(matrices[index % 2]));
+	});
+
+	harness.run("Kernels::Vectorized::invertRigid", [&](auto index) {
+		keep(KinovaZED::Kernels::Vectorized::invertRigid(matrices[index % 2]));
+	});
+
+	auto points = std::vector<KinovaZED::Vec3>(waypoints);
+	for (auto index = std::size_t{}; index < waypoints; ++index) {
+		points[index] = {static_cast<float>(index % 100) * 0.001f, 0.008f, -0.1f};
+	}
+	auto transformed = std::vector<KinovaZED::Vec3>(waypoints);
+
+	harness.run("Kernels::Scalar::transformPoints (1000 points)", [&](auto index) {
+		KinovaZED::Kernels::Scalar::transformPoints(matrices[index % 2], points.data(), transformed.data(), waypoints);
+		keep(transformed.back());
+	});
+
+	harness.run("Kernels::Vectorized::transformPoints (1000 points)", [&](auto index) {
+		KinovaZED::Kernels::Vectorized::transformPoints(
+		    matrices[index % 2], points.data(), transformed.data(), waypoints);
+		keep(transformed.back());
+	});
+}
+
+/**
+ * Benchmark the poses in math/Pose.h and the origins in hw/Origin.h
+ */
+auto benchmarkPoses(Harness &harness) -> void {
+	auto const coordinates = std::array{openDoorOrigin, handleOrigin};
+	auto const origin = Origin{openDoorOrigin};
+	auto const poses = std::array{KinovaZED::Pose::fromCoordinates(firstWaypoint),
+	                              KinovaZED::Pose::fromCoordinates(secondWaypoint)};
+
+	harness.run("Origin construction", [&](auto index) { keep(Origin{coordinates[index % 2]}); });
+
+	harness.run("Pose::fromCoordinates", [&](auto index) {
+		keep(KinovaZED::Pose::fromCoordinates(coordinates[index % 2]));
+	});
+
+	harness.run("Pose composition", [&](auto index) { keep(origin.getPose() * poses[index % 2]); });
+
+	harness.run("Pose::toCoordinates", [&](auto index) {
+		keep((origin.getPose() * poses[index % 2]).toCoordinates());
+	});
+}
+
+/**
+ * Benchmark the double precision variants of the matrix, pose and origin paths
+ *
+ * The names match the float benchmarks above, so that the cost of the opt-in double path can be compared directly.
+ */
+auto benchmarkDoubles(Harness &harness) -> void {
+	auto const origins = std::array{BasicOrigin<double>{openDoorOrigin}, BasicOrigin<double>{handleOrigin}};
+	auto const matrices = std::array{origins[0].getTransformationMatrix(), origins[1].getTransformationMatrix()};
+	auto const angles = std::array{KinovaZED::Vec3d{openDoorOrigin.pitch, openDoorOrigin.yaw, openDoorOrigin.roll},
+	                               KinovaZED::Vec3d{handleOrigin.pitch, handleOrigin.yaw, handleOrigin.roll}};
+	auto const coordinates = std::array{openDoorOrigin, handleOrigin};
+	auto const points = std::array{firstWaypoint, secondWaypoint};
+	auto const poses = std::array{BasicPose<double>::fromCoordinates(firstWaypoint),
+	                              BasicPose<double>::fromCoordinates(secondWaypoint)};
+
+	harness.run("matMultiply (4x4, double)", [&](auto index) {
+		keep(KinovaZED::matMultiply(matrices[index % 2], matrices[0]));
+	});
+
+	harness.run("rotMatrix (double)", [&](auto index) { keep(KinovaZED::rotMatrix(angles[index % 2].data())); });
+
+	harness.run("coordTransform (double)", [&](auto index) {
+		keep(KinovaZED::coordTransform(points[index % 2], matrices[0]));
+	});
+
+	harness.run("Kernels::compose (double)", [&](auto index) {
+		keep(KinovaZED::Kernels::compose(matrices[index % 2], matrices[0]));
+	});
+
+	harness.run("Origin construction (double)", [&](auto index) {
+		keep(BasicOrigin<double>{coordinates[index % 2]});
+	});
+
+	harness.run("Pose composition (double)", [&](auto index) { keep(origins[0].getPose() * poses[index % 2]); });
+}
+
+/**
+ * Benchmark a long chain of relative poses, as it is composed when teaching a sequence of relative objectives
+ */
+template<typename ScalarType>
+auto benchmarkChain(Harness &harness, std::string const &name) -> void {
+	auto const start = BasicPose<ScalarType>::fromCoordinates(openDoorOrigin);
+	auto const steps = std::array{BasicPose<ScalarType>::fromCoordinates(firstWaypoint),
+	                              BasicPose<ScalarType>::fromCoordinates(secondWaypoint)};
+
+	harness.run(name, [&](auto index) {
+		auto pose = start;
+		for (auto link = std::size_t{}; link < chainLength; ++link) {
+			pose = pose * steps[(index + link) % 2];
+		}
+		keep(pose);
+	});
+}
+
+/**
+ * Benchmark the objective paths in control/Objective.h
+ */
+auto benchmarkObjectives(Harness &harness, KinovaZED::Logger logger) -> void {
+	auto const pristine = makeObjective(logger);
+
+	// Assigning the pristine objective reuses the storage of the exhausted one, so the reset does not allocate
+	auto objective = pristine;
+	harness.run("Objective::nextPoint", [&](auto) {
+		auto point = objective.nextPoint();
+		if (!point) {
+			objective = pristine;
+			point = objective.nextPoint();
+		}
+		keep(point);
+	});
+
+	auto relocated = pristine;
+	harness.run("Objective::setOrigin (1000 waypoints)", [&](auto index) {
+		relocated.setOrigin(index % 2 ? openDoorOrigin : handleOrigin);
+		keep(relocated);
+	});
+}
+
+} // namespace
+
+/**
+ * Measure the math and objective paths, which are used in every control cycle of the arm
+ */
+int main(int argc, char **argv) {
+	auto configuration = KinovaZED::Bench::Configuration{};
+	auto minimumRepetitionTime = std::size_t{5};
+	auto json{false};
+	auto showHelp{false};
+
+	auto cli = lyra::cli_parser() |                                                                                 //
+	    lyra::opt(configuration.warmups, "count")["--warmups"]("Number of untimed repetitions") |                   //
+	    lyra::opt(configuration.repetitions, "count")["--repetitions"]("Number of timed repetitions") |             //
+	    lyra::opt(minimumRepetitionTime, "milliseconds")["--min-time"]("Minimal duration of a single repetition") | //
+	    lyra::opt(configuration.filter, "name")["--filter"]("Only run benchmarks whose name contains this") |       //
+	    lyra::opt(json)["--json"]("Write JSON instead of a table") |                                                //
+	    lyra::help(showHelp);
+	auto result = cli.parse({argc, argv});
+
+	if (!result || showHelp || !configuration.repetitions) {
+		std::cout << cli;
+		return result && showHelp ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	configuration.minimumRepetitionTime = std::chrono::milliseconds{minimumRepetitionTime};
+
+	auto const logger = KinovaZED::makeLogger({"KinovaBench", {}, {}, {}});
+	auto harness = Harness{configuration};
+	benchmarkMatrices(harness);
+	benchmarkKernels(harness);
+	benchmarkPoses(harness);
+	benchmarkDoubles(harness);
+	benchmarkChain<float>(harness, "Pose chain (1000 links)");
+	benchmarkChain<double>(harness, "Pose chain (1000 links, double)");
+	benchmarkObjectives(harness, logger);
+
+	if (json) {
+		writeJson(harness.getResults(), configuration, std::cout);
+	} else {
+		writeText(harness.getResults(), std::cout);
+	}
+}
@@ -0,0 +1,95 @@
+#[=[
+Generate the table of embedded objectives.
+
+When EMBED is set, the objectives in SOURCE are converted into constant tables. Otherwise, empty tables are generated,
+so that the application always falls back to loading its objectives at runtime.
+#]=]
+
+function(embed_objectives)
+  set(OPTIONS "EMBED")
+  set(SINGLE_VALUE_KEYWORDS "SOURCE" "TEMPLATE" "OUTPUT")
+  set(MULTI_VALUE_KEYWORDS "")
+
+  cmake_parse_arguments(EMBED_OBJECTIVES
+    "${OPTIONS}"
+    "${SINGLE_VALUE_KEYWORDS}"
+    "${MULTI_VALUE_KEYWORDS}"
+    ${ARGN}
+  )
+
+  if(NOT EMBED_OBJECTIVES_TEMPLATE)
+    message(FATAL_ERROR "Missing argument TEMPLATE")
+  endif()
+
+  if(NOT EMBED_OBJECTIVES_OUTPUT)
+    message(FATAL_ERROR "Missing argument OUTPUT")
+  endif()
+
+  set(EMBEDDED_OBJECTIVES_SOURCE "no file, since EMBED_OBJECTIVES is OFF")
+  set(EMBEDDED_OBJECTIVES_COUNT "0")
+  set(EMBEDDED_OBJECTIVES_ROWS "")
+  set(EMBEDDED_WAYPOINTS_COUNT "0")
+  set(EMBEDDED_WAYPOINTS_ROWS "")
+
+  if(EMBED_OBJECTIVES_EMBED)
+    if(CMAKE_VERSION VERSION_LESS "3.19")
+      message(FATAL_ERROR "Embedding the objectives requires CMake 3.19 or newer")
+    endif()
+
+    if(NOT EXISTS "${EMBED_OBJECTIVES_SOURCE}")
+      message(FATAL_ERROR "Objectives file '${EMBED_OBJECTIVES_SOURCE}' does not exist")
+    endif()
+
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${EMBED_OBJECTIVES_SOURCE}")
+    file(READ "${EMBED_OBJECTIVES_SOURCE}" JSON)
+    get_filename_component(EMBEDDED_OBJECTIVES_SOURCE "${EMBED_OBJECTIVES_SOURCE}" NAME)
+
+    string(JSON EMBEDDED_OBJECTIVES_COUNT LENGTH "${JSON}")
+    if(EMBEDDED_OBJECTIVES_COUNT GREATER "0")
+      math(EXPR LAST_OBJECTIVE "${EMBEDDED_OBJECTIVES_COUNT} - 1")
+      foreach(OBJECTIVE RANGE ${LAST_OBJECTIVE})
+        string(JSON NAME GET "${JSON}" ${OBJECTIVE} "name")
+        string(JSON OBJECTIVE_IS_ABSOLUTE GET "${JSON}" ${OBJECTIVE} "is_abs")
+        _embed_objectives_coordinates(ORIGIN "${JSON}" ${OBJECTIVE} "origin")
+
+        string(JSON SEQUENCE_LENGTH LENGTH "${JSON}" ${OBJECTIVE} "sequence")
+        if(SEQUENCE_LENGTH GREATER "0")
+          math(EXPR LAST_WAYPOINT "${SEQUENCE_LENGTH} - 1")
+          foreach(WAYPOINT RANGE ${LAST_WAYPOINT})
+            _embed_objectives_coordinates(COORDINATES "${JSON}" ${OBJECTIVE} "sequence" ${WAYPOINT})
+            string(APPEND EMBEDDED_WAYPOINTS_ROWS "    {${COORDINATES}},\n")
+          endforeach()
+        endif()
+
+        if(OBJECTIVE_IS_ABSOLUTE)
+          set(OBJECTIVE_IS_ABSOLUTE "true")
+        else()
+          set(OBJECTIVE_IS_ABSOLUTE "false")
+        endif()
+
+        set(WAYPOINTS "${EMBEDDED_WAYPOINTS_COUNT}, ${SEQUENCE_LENGTH}")
+        string(APPEND EMBEDDED_OBJECTIVES_ROWS
+          "    {Objective::Id::${NAME}, ${OBJECTIVE_IS_ABSOLUTE}, {${ORIGIN}}, ${WAYPOINTS}},\n"
+        )
+        math(EXPR EMBEDDED_WAYPOINTS_COUNT "${EMBEDDED_WAYPOINTS_COUNT} + ${SEQUENCE_LENGTH}")
+      endforeach()
+    endif()
+
+    message(STATUS "Embedding ${EMBEDDED_OBJECTIVES_COUNT} objectives from ${EMBED_OBJECTIVES_SOURCE}")
+  endif()
+
+  configure_file("${EMBED_OBJECTIVES_TEMPLATE}"
+    "${EMBED_OBJECTIVES_OUTPUT}"
+    @ONLY
+  )
+endfunction()
+
+function(_embed_objectives_coordinates OUTPUT JSON)
+  set(VALUES "")
+  foreach(KEY "X" "Y" "Z" "pitch" "yaw" "roll")
+    string(JSON VALUE GET "${JSON}" ${ARGN} "${KEY}")
+    list(APPEND VALUES "${VALUE}")
+  endforeach()
+  list(JOIN VALUES ", " VALUES)
+  set(${OUTPUT} "${VALUES}" PARENT_SCOPE)
+endfunction()
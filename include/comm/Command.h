@@ -4,6 +4,7 @@
 #include "support/ToString.h"
 
 #include <any>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -26,6 +27,8 @@ struct Command {
 		SetActiveObjective,
 		GetObjectivePosition,
 		GetAbsolutePosition,
+		GetUpdateStatistics,
+		GetTransactionStatistics,
 
 		// End Marker
 		END_OF_ENUM
@@ -33,6 +36,19 @@ struct Command {
 
 	Id id;
 	std::vector<std::any> parameters;
+
+	/**
+	 * The index of the arm the command is addressed to, if it names one
+	 */
+	std::optional<std::size_t> arm{};
+
+	/**
+	 * Check if the command is addressed to the arm with the given index
+	 *
+	 * Commands that do not name an arm are addressed to the first arm, except for emergency stops, which are addressed
+	 * to all arms.
+	 */
+	auto isAddressedTo(std::size_t index) const -> bool;
 };
 
 auto isKnownCommandId(int candidate) -> bool;
@@ -4,11 +4,12 @@
 #include "comm/Command.h"
 #include "comm/Heartbeat.h"
 #include "comm/Notification.h"
+#include "support/SubscriberList.h"
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
-#include <set>
 #include <string>
 #include <type_traits>
 
@@ -35,6 +36,8 @@ struct CommandInterface {
 	/**
 	 * Add a new subscriber to the list of known subscribers
 	 *
+	 * Subscribers can be added and removed from any thread, even while commands are being delivered.
+	 *
 	 * @return Whether or not a new subscription was added
 	 */
 	auto subscribe(SubscriberPointer subscriber) -> bool;
@@ -46,6 +49,15 @@ struct CommandInterface {
 	 */
 	auto unsubscribe(SubscriberPointer subscriber) -> bool;
 
+	/**
+	 * Set how many arms there are to receive commands
+	 *
+	 * Commands addressed to an arm beyond this count are rejected, instead of being passed on to the subscribers.
+	 *
+	 * @note This function must be called before the interface is started
+	 */
+	auto setArmCount(std::size_t count) -> void;
+
 	/**
 	 * Send a notification to the remote controller
 	 */
@@ -89,7 +101,8 @@ struct CommandInterface {
 
   private:
 	CommandFactory commandFactory;
-	std::set<SubscriberPointer> subscribers;
+	SubscriberList<CommandSubscriber> subscribers;
+	std::optional<std::size_t> armCount{};
 };
 
 } // namespace KinovaZED::Comm
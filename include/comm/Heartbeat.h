@@ -4,6 +4,7 @@
 #include "support/ToString.h"
 
 #include <bitset>
+#include <cstddef>
 #include <string>
 
 
@@ -11,6 +12,11 @@ namespace KinovaZED::Comm {
 
 struct Heartbeat {
 	std::bitset<8> state;
+
+	/**
+	 * The index of the arm the heartbeat reports on
+	 */
+	std::size_t arm{};
 };
 
 } // namespace KinovaZED::Comm
@@ -3,6 +3,7 @@
 
 #include "support/ToString.h"
 
+#include <cstddef>
 #include <string>
 
 namespace KinovaZED::Comm {
@@ -23,12 +24,18 @@ struct Notification {
 		END_OF_ENUM,
 	};
 
-	explicit Notification(Id id);
+	explicit Notification(Id id, std::size_t arm = 0);
 
 	auto getId() const noexcept -> Id;
 
+	/**
+	 * Get the index of the arm the notification originates from
+	 */
+	auto getArm() const noexcept -> std::size_t;
+
   private:
 	Id id;
+	std::size_t arm;
 };
 
 auto isKnownNotificationId(int candidate) -> bool;
@@ -7,14 +7,18 @@
 #include "control/Objective.h"
 #include "control/ObjectiveManager.h"
 #include "hw/Actor.h"
+#include "hw/Coordinates.h"
+#include "support/Expected.h"
 #include "support/Logging.h"
 
 #include <sml/sml.hpp>
 
 #include <bitset>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 constexpr int numberOfJoystickMoveInputs = 3;
 
@@ -36,14 +40,33 @@ struct CoreController : std::enable_shared_from_this<CoreController>,
 
 	auto getSystemState() -> std::bitset<8>;
 
+	/**
+	 * Record the telemetry of the arm into the given recorder, together with the state of this controller
+	 */
+	auto setTelemetryRecorder(std::shared_ptr<Hw::TelemetryRecorder> recorder) -> void;
+
+	/**
+	 * Get the index of the arm this controller is responsible for
+	 */
+	auto getArmIndex() const noexcept -> std::size_t;
+
+	/**
+	 * Set how many objective waypoints are queued on the arm ahead of the one it is currently moving towards
+	 *
+	 * With a lookahead of zero, the arm stops at every waypoint before it is sent towards the next one.
+	 */
+	auto setWaypointLookahead(std::size_t count) -> void;
+
   protected:
 	CoreController(Comm::CommandInterface &interface,
 	               Hw::Actor &actor,
+	               std::size_t armIndex,
 	               ObjectiveManager &objectiveManager,
 	               Logger logger);
 
 	Comm::CommandInterface &commandSource;
 	Hw::Actor &arm;
+	std::size_t const armIndex;
 	ObjectiveManager &objectiveManager;
 	boost::sml::sm<CoreStateMachine> stateMachine;
 
@@ -52,6 +75,7 @@ struct CoreController : std::enable_shared_from_this<CoreController>,
 		return [this, function = std::move(function)](auto event, std::string stepMessage, std::string failureMessage) {
 			logInfo(function, stepMessage);
 			auto didAccept = stateMachine.process_event(event);
+			publishControllerState();
 			if (!didAccept) {
 				logWarning(function, failureMessage);
 			}
@@ -59,12 +83,39 @@ struct CoreController : std::enable_shared_from_this<CoreController>,
 		};
 	}
 
+	/**
+	 * Take the waypoints that are queued behind the current one from the objective
+	 *
+	 * @return The waypoints, or the error of the first one that is not reachable
+	 */
+	auto collectLookahead() -> Expected<std::vector<Hw::Coordinates>, Hw::CoordinateError>;
+
+	/**
+	 * Give up on the current objective, stop the arm if it is running a sequence and reject the objective
+	 */
+	auto abortObjective(std::string function) -> void;
+
+	/**
+	 * Get the bits of the system state that are owned by the controller, without asking the arm
+	 */
+	auto controllerState() -> std::bitset<8>;
+	auto publishControllerState() -> void;
+
 	std::optional<Objective> currentObjective{};
+	std::shared_ptr<Hw::TelemetryRecorder> telemetryRecorder{};
+	std::size_t waypointLookahead{2};
+	std::size_t waypointsInFlight{};
 	bool isInitialized{};
 };
 
+/**
+ * Create a controller for the arm with the given index
+ *
+ * The controller only processes commands addressed to its arm, and tags all of its notifications with the index.
+ */
 auto makeCoreController(Comm::CommandInterface &interface,
                         Hw::Actor &actor,
+                        std::size_t armIndex,
                         ObjectiveManager &objectiveManager,
                         Logger logger) -> std::shared_ptr<CoreController>;
 
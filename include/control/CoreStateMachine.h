@@ -7,6 +7,7 @@
 #include <sml/sml.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace KinovaZED::Control {
 
@@ -65,6 +66,13 @@ struct CoreStateMachine : LoggingMixin {
 		struct RunObjective : ActorEventBase<RunObjective> {
 			auto operator()() const -> void;
 
+			Hw::Coordinates position;
+			std::vector<Hw::Coordinates> lookahead{};
+		};
+
+		struct QueueWaypoint : ActorEventBase<QueueWaypoint> {
+			auto operator()() const -> void;
+
 			Hw::Coordinates position;
 		};
 
@@ -83,7 +91,11 @@ struct CoreStateMachine : LoggingMixin {
 			int z;
 		};
 
-		struct SequenceFinished : ActorEventBase<JoystickMoved> {
+		struct SequenceFinished : ActorEventBase<SequenceFinished> {
+			auto operator()() const -> void;
+		};
+
+		struct AbortSequence : ActorEventBase<AbortSequence> {
 			auto operator()() const -> void;
 		};
 	};
@@ -159,7 +171,9 @@ struct CoreStateMachine : LoggingMixin {
 			steering         + event<Event::EStop>                      / eventAction = emergencyStopped,
 
 			runningSequence  + event<Event::RunObjective>               / eventAction = runningSequence,
+			runningSequence  + event<Event::QueueWaypoint>              / eventAction,
 			runningSequence  + event<Event::SequenceFinished>           / eventAction = idle,
+			runningSequence  + event<Event::AbortSequence>              / eventAction = idle,
 			runningSequence  + event<Event::SetJoystickMode>            / eventAction = settingMode,
 			runningSequence  + event<Event::EStop>                      / eventAction = emergencyStopped,
 
@@ -9,15 +9,24 @@
 #include <asio/steady_timer.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace KinovaZED::Control {
 
+/**
+ * Periodically send the system state of every controller to the command interface, one heartbeat per arm
+ */
 struct HeartbeatGenerator : LoggingMixin {
 	HeartbeatGenerator(Comm::CommandInterface &sink,
 	                   std::weak_ptr<CoreController> controller,
 	                   asio::io_context &timerContext,
 	                   Logger logger);
 
+	HeartbeatGenerator(Comm::CommandInterface &sink,
+	                   std::vector<std::weak_ptr<CoreController>> controllers,
+	                   asio::io_context &timerContext,
+	                   Logger logger);
+
 	~HeartbeatGenerator() noexcept;
 
 	auto start() -> void;
@@ -27,7 +36,7 @@ struct HeartbeatGenerator : LoggingMixin {
 	auto beat() -> void;
 
 	Comm::CommandInterface &sink;
-	std::weak_ptr<CoreController> controller;
+	std::vector<std::weak_ptr<CoreController>> controllers;
 	asio::io_context &timerContext;
 	asio::steady_timer timer{timerContext};
 };
@@ -4,6 +4,8 @@
 #include "hw/Actor.h"
 #include "hw/Coordinates.h"
 #include "hw/Origin.h"
+#include "math/Pose.h"
+#include "support/Expected.h"
 #include "support/Logging.h"
 #include "support/ToString.h"
 
@@ -15,6 +17,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace KinovaZED::Control {
 
@@ -36,6 +39,7 @@ struct Objective : LoggingMixin {
 	};
 
 	Objective(nlohmann::json const &json, Logger logger);
+	Objective(Id id, Hw::Coordinates origin, std::vector<Hw::Coordinates> sequence, bool absolute, Logger logger);
 
 	auto getOrigin() const -> Hw::Origin;
 	auto setOrigin(Hw::Coordinates point) -> void;
@@ -43,14 +47,28 @@ struct Objective : LoggingMixin {
 	auto getId() const -> Id;
 	auto isAbsolute() const -> bool;
 
-	auto nextPoint() -> std::optional<Hw::Coordinates>;
+	/**
+	 * Advance to the next waypoint of the sequence
+	 *
+	 * @return Nothing once the sequence is exhausted, or the waypoint in the coordinate system of the arm. If the
+	 * waypoint cannot be reached from the current origin, the error that prevented its transformation is returned
+	 * instead.
+	 */
+	auto nextPoint() -> std::optional<Expected<Hw::Coordinates, Hw::CoordinateError>>;
 
   private:
 	friend auto to_json(nlohmann::json &output, Objective const &objective) -> void;
 
+	/**
+	 * Transform all waypoints into the coordinate system of the arm, using the current origin
+	 */
+	auto transformWaypoints() -> void;
+
 	Id id;
 	Hw::Origin origin;
 	std::vector<Hw::Coordinates> sequence;
+	std::vector<Pose> waypoints;
+	std::vector<Expected<Hw::Coordinates, Hw::CoordinateError>> targets;
 	bool absolute;
 
 	std::make_signed_t<std::size_t> currentSequenceIndex{-1};
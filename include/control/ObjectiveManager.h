@@ -4,18 +4,27 @@
 #include "control/Objective.h"
 #include "support/Logging.h"
 
+#include <iosfwd>
 #include <map>
 #include <vector>
 
 namespace KinovaZED::Control {
 
+/**
+ * The objectives known to the application
+ *
+ * The objectives that were embedded at build time are always loaded first. Objectives loaded from an input stream
+ * replace the embedded objectives with the same ID.
+ */
 struct ObjectiveManager : LoggingMixin {
+	explicit ObjectiveManager(Logger logger);
 	ObjectiveManager(std::istream &in, Logger logger);
 
 	auto getObjective(Objective::Id id) const -> Objective const &;
 	auto getObjective(Objective::Id id) -> Objective &;
 
   private:
+	auto loadEmbeddedObjectives() -> void;
 	auto loadObjectives(std::istream &in) -> void;
 
 	std::map<Objective::Id, Objective> objectives{};
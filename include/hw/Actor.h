@@ -2,12 +2,16 @@
 #define INCLUDE_HW_ACTOR_H_
 
 #include "hw/Coordinates.h"
+#include "hw/TelemetryRecorder.h"
+#include "hw/TransactionStatistics.h"
+#include "hw/UpdateStatistics.h"
+#include "support/SubscriberList.h"
 #include "support/ToString.h"
 
 #include <atomic>
-#include <future>
+#include <functional>
+#include <memory>
 #include <optional>
-#include <set>
 
 namespace KinovaZED::Hw {
 
@@ -56,6 +60,23 @@ struct Actor {
 
 	using EventSubscriberPtr = std::shared_ptr<EventSubscriber>;
 
+	/**
+	 * A handler that gets invoked once an asynchronous operation has finished
+	 *
+	 * Handlers are invoked on the execution context of the concrete actor implementation. They must therefore not
+	 * block, and must not wait for the result of another operation of the same actor.
+	 *
+	 * The state queries (asyncHasFailed, asyncGetPosition and asyncGetSteeringMode) are the exception: an
+	 * implementation may answer them from the last published state, and invoke the handler synchronously on the
+	 * calling thread before the call returns.
+	 */
+	template<typename... ResultTypes>
+	using CompletionHandler = std::function<void(ResultTypes...)>;
+
+	virtual ~Actor() noexcept = default;
+
+	/// @section Blocking Interface
+
 	/**
 	 * Connect to the actor
 	 */
@@ -101,6 +122,11 @@ struct Actor {
 	 */
 	auto moveTo(Coordinates position) -> void;
 
+	/**
+	 * Queue the given position behind the current movement target without interrupting the current movement
+	 */
+	auto appendTarget(Coordinates position) -> void;
+
 	/**
 	 * Set the joystick input
 	 */
@@ -126,9 +152,121 @@ struct Actor {
 	 */
 	auto getSteeringMode() const -> std::optional<SteeringMode>;
 
+	/**
+	 * Get the timing statistics of the state update loop
+	 */
+	auto getUpdateStatistics() const -> UpdateStatistics;
+
+	/**
+	 * Get the latency and error statistics of the USB transactions with the arm
+	 */
+	auto getTransactionStatistics() const -> TransactionStatistics;
+
+	/// @section Asynchronous Interface
+
+	/**
+	 * Connect to the actor and report whether the connection was established
+	 */
+	auto asyncConnect(CompletionHandler<bool> handler) -> void;
+
+	/**
+	 * Disconnect from the actor
+	 */
+	auto asyncDisconnect(CompletionHandler<> handler) -> void;
+
+	/**
+	 * Take control over the actor and report whether control was gained
+	 */
+	auto asyncTakeControl(CompletionHandler<bool> handler) -> void;
+
+	/**
+	 * Release control over the actor and report whether control was released
+	 */
+	auto asyncReleaseControl(CompletionHandler<bool> handler) -> void;
+
+	/**
+	 * Initialize the actor for operation
+	 */
+	auto asyncInitialize(CompletionHandler<> handler) -> void;
+
+	/**
+	 * Stop all ongoing movements and report whether the actor came to a stop
+	 *
+	 * A stop that is superseded by a later one before it finished reports false, possibly from within the later call.
+	 */
+	auto asyncStopMoving(CompletionHandler<bool> handler) -> void;
+
+	/**
+	 * Move the arm into its home position
+	 */
+	auto asyncHome(CompletionHandler<> handler) -> void;
+
+	/**
+	 * Retract the arm into its resting position
+	 */
+	auto asyncRetract(CompletionHandler<> handler) -> void;
+
+	/**
+	 * Move to the given position
+	 */
+	auto asyncMoveTo(Coordinates position, CompletionHandler<> handler) -> void;
+
+	/**
+	 * Queue the given position behind the current movement target without interrupting the current movement
+	 */
+	auto asyncAppendTarget(Coordinates position, CompletionHandler<> handler) -> void;
+
+	/**
+	 * Set the joystick input
+	 */
+	auto asyncSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void;
+
+	/**
+	 * Set the current steering mode and report whether the mode change was accepted
+	 */
+	auto asyncSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void;
+
+	/**
+	 * Check if the arm has failed
+	 *
+	 * @note The handler may be invoked synchronously on the calling thread
+	 */
+	auto asyncHasFailed(CompletionHandler<bool> handler) const -> void;
+
+	/**
+	 * Get the current position of the actor
+	 *
+	 * @note The handler may be invoked synchronously on the calling thread
+	 */
+	auto asyncGetPosition(CompletionHandler<Coordinates> handler) const -> void;
+
+	/**
+	 * Get the current steering mode
+	 *
+	 * @note The handler may be invoked synchronously on the calling thread
+	 */
+	auto asyncGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void;
+
+	/**
+	 * Get the timing statistics of the state update loop
+	 */
+	auto asyncGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void;
+
+	/**
+	 * Get the latency and error statistics of the USB transactions with the arm
+	 */
+	auto asyncGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void;
+
+	/// @section Configuration and Events
+
 	auto setShouldReconnectOnError(bool reconnect) -> void;
 	auto shouldReconnectOnError() -> bool;
 
+	/**
+	 * Record a telemetry sample into the given recorder on every state update, or stop recording if it is empty
+	 */
+	auto setTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void;
+
 	auto subscribe(EventSubscriberPtr subscriber) -> bool;
 	auto unsubscribe(EventSubscriberPtr subscriber) -> bool;
 
@@ -141,23 +279,27 @@ struct Actor {
 	auto fireInitializationFinished() -> void;
 
   private:
-	auto virtual doConnect(std::promise<bool> token) -> void = 0;
-	auto virtual doDisconnect(std::promise<void> token) -> void = 0;
-	auto virtual doTakeControl(std::promise<bool> token) -> void = 0;
-	auto virtual doReleaseControl(std::promise<bool> token) -> void = 0;
-	auto virtual doInitialize(std::promise<void> token) -> void = 0;
-	auto virtual doStopMoving(std::promise<bool> token) -> void = 0;
-	auto virtual doHome(std::promise<void> token) -> void = 0;
-	auto virtual doRetract(std::promise<void> token) -> void = 0;
-	auto virtual doMoveTo(Coordinates position, std::promise<void> token) -> void = 0;
-	auto virtual doSetJoystick(int x, int y, int z, std::promise<void> token) -> void = 0;
-	auto virtual doSetSteeringMode(SteeringMode mode, std::promise<bool> token) -> void = 0;
-	auto virtual doHasFailed(std::promise<bool> token) const -> void = 0;
-	auto virtual doGetPosition(std::promise<Coordinates> token) const -> void = 0;
-	auto virtual doGetSteeringMode(std::promise<std::optional<SteeringMode>> token) const -> void = 0;
+	auto virtual doConnect(CompletionHandler<bool> handler) -> void = 0;
+	auto virtual doDisconnect(CompletionHandler<> handler) -> void = 0;
+	auto virtual doTakeControl(CompletionHandler<bool> handler) -> void = 0;
+	auto virtual doReleaseControl(CompletionHandler<bool> handler) -> void = 0;
+	auto virtual doInitialize(CompletionHandler<> handler) -> void = 0;
+	auto virtual doStopMoving(CompletionHandler<bool> handler) -> void = 0;
+	auto virtual doHome(CompletionHandler<> handler) -> void = 0;
+	auto virtual doRetract(CompletionHandler<> handler) -> void = 0;
+	auto virtual doMoveTo(Coordinates position, CompletionHandler<> handler) -> void = 0;
+	auto virtual doAppendTarget(Coordinates position, CompletionHandler<> handler) -> void = 0;
+	auto virtual doSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void = 0;
+	auto virtual doSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void = 0;
+	auto virtual doHasFailed(CompletionHandler<bool> handler) const -> void = 0;
+	auto virtual doGetPosition(CompletionHandler<Coordinates> handler) const -> void = 0;
+	auto virtual doGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void = 0;
+	auto virtual doGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void = 0;
+	auto virtual doGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void = 0;
+	auto virtual doSetTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void = 0;
 
 	std::atomic_bool reconnectOnError{false};
-	std::set<EventSubscriberPtr> eventSubscribers{};
+	SubscriberList<EventSubscriber> eventSubscribers{};
 };
 
 } // namespace KinovaZED::Hw
@@ -0,0 +1,43 @@
+#ifndef INCLUDE_HW_CONNECTION_STATISTICS_H_
+#define INCLUDE_HW_CONNECTION_STATISTICS_H_
+
+#include "support/ToString.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace KinovaZED::Hw {
+
+/**
+ * Statistics of an actor's attempts to reconnect after losing the connection to its arm
+ */
+struct ConnectionStatistics {
+	/**
+	 * Record a single reconnection attempt
+	 */
+	auto recordAttempt(bool succeeded) noexcept -> void;
+
+	/**
+	 * Record that the connection was restored after having been lost for the given time
+	 */
+	auto recordReconnect(std::chrono::nanoseconds downtime) noexcept -> void;
+
+	std::uint64_t attempts{};
+	std::uint64_t failedAttempts{};
+	std::uint64_t reconnects{};
+	std::chrono::nanoseconds lastDowntime{};
+	std::chrono::nanoseconds worstDowntime{};
+	std::chrono::nanoseconds totalDowntime{};
+};
+
+} // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::ConnectionStatistics const &statistics) -> std::string;
+
+} // namespace KinovaZED
+
+#endif
@@ -1,6 +1,10 @@
 #ifndef INCLUDE_HW_COORDINATES_H_
 #define INCLUDE_HW_COORDINATES_H_
 
+#include "support/Expected.h"
+#include "support/Simd.h"
+#include "support/ToString.h"
+
 #include <fmt/format.h>
 #include <nlohmann/json.hpp>
 
@@ -8,14 +12,36 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace KinovaZED::Hw {
 
-struct Coordinates {
+/**
+ * The reasons for a set of coordinates to be outside of the arm's reachable box
+ */
+enum struct CoordinateError {
+	XOutOfRange,
+	YOutOfRange,
+	ZOutOfRange,
+
+	// End Marker
+	END_OF_ENUM,
+};
+
+/**
+ * A cartesian pose of the arm
+ *
+ * The six values are padded to eight lanes, so that the comparison and arithmetic helpers below can process a pose as
+ * two 4-lane SIMD vectors.
+ */
+struct alignas(16) Coordinates {
 	Coordinates() = default;
 	Coordinates(float x, float y, float z, float pitch, float yaw, float roll)
 	    : x{x}
@@ -27,6 +53,43 @@ struct Coordinates {
 		checkCooridateValues(x, y, z);
 	}
 
+	/**
+	 * Create coordinates, reporting values outside of the reachable box as an error instead of throwing
+	 */
+	static auto make(float x, float y, float z, float pitch, float yaw, float roll) noexcept
+	    -> Expected<Coordinates, CoordinateError> {
+		if (auto error = validate(x, y, z)) {
+			return Unexpected{*error};
+		}
+
+		auto coordinates = Coordinates{};
+		coordinates.x = x;
+		coordinates.y = y;
+		coordinates.z = z;
+		coordinates.pitch = pitch;
+		coordinates.yaw = yaw;
+		coordinates.roll = roll;
+		return coordinates;
+	}
+
+	/**
+	 * Check whether the given position is inside of the reachable box
+	 *
+	 * @return The reason why the position is not valid, if any
+	 */
+	static auto validate(float x, float y, float z) noexcept -> std::optional<CoordinateError> {
+		if (x < -0.8f || x > 0.8) {
+			return CoordinateError::XOutOfRange;
+		}
+		if (y < -0.85 || y > 0.85) {
+			return CoordinateError::YOutOfRange;
+		}
+		if (z >= 1.15) {
+			return CoordinateError::ZOutOfRange;
+		}
+		return std::nullopt;
+	}
+
 	explicit Coordinates(std::vector<float> const &data)
 	    : Coordinates{data[0], data[1], data[2], data[3], data[4], data[5]} {
 	}
@@ -57,11 +120,7 @@ struct Coordinates {
 		return {x, y, z, pitch, yaw, roll};
 	}
 
-	auto isZero() const -> bool {
-		auto isZero = [](auto const &location) { return std::fabs(location) < epsilon; };
-		std::array<float, 6> values = *this;
-		return std::all_of(begin(values), end(values), isZero);
-	}
+	auto isZero() const -> bool;
 
 	friend void from_json(nlohmann::json const &j, Coordinates &c);
 	friend void to_json(nlohmann::json &j, Coordinates const &c);
@@ -78,42 +137,178 @@ struct Coordinates {
 	float yaw = 0.0f;
 	float roll = 0.0f;
 
+	/**
+	 * Unused lanes that pad the coordinates to two SIMD vectors, always zero
+	 */
+	std::array<float, 2> padding{};
+
   private:
 	static void checkCooridateValues(float x, float y, float z) {
-		if (x < -0.8f || x > 0.8) {
+		switch (validate(x, y, z).value_or(CoordinateError::END_OF_ENUM)) {
+		case CoordinateError::XOutOfRange:
 			throw std::invalid_argument{fmt::format("Value of x is outside of valid range [-0.8, 0.8]: {}", x)};
-		}
-		if (y < -0.85 || y > 0.85) {
+		case CoordinateError::YOutOfRange:
 			throw std::invalid_argument{fmt::format("Value of y is outside of valid range [-0.85, 0.85]: {}", y)};
-		}
-		if (z >= 1.15) {
+		case CoordinateError::ZOutOfRange:
 			throw std::invalid_argument{fmt::format("Value of z is outside of valid range [?, 1.15]: {}", z)};
+		case CoordinateError::END_OF_ENUM:
+			break;
 		}
 	}
 };
 
-static auto isEqualFloat(float lhs, float rhs) {
-	return std::fabs(lhs - rhs) < Coordinates::epsilon;
+static_assert(sizeof(Coordinates) == 8 * sizeof(float), "Coordinates must fill exactly two SIMD vectors!");
+static_assert(std::is_trivially_copyable_v<Coordinates>, "Coordinates must be trivially copyable!");
+static_assert(std::is_standard_layout_v<Coordinates>, "Coordinates must have standard layout!");
+
+namespace Detail {
+
+/**
+ * The lanes of a pose, with x, y, z and pitch in the low vector and yaw, roll and the padding in the high vector
+ */
+struct CoordinateLanes {
+	Simd::Float4 low;
+	Simd::Float4 high;
+};
+
+inline auto toLanes(Coordinates const &coordinates) noexcept -> CoordinateLanes {
+	alignas(16) float values[8];
+	std::memcpy(values, &coordinates, sizeof(values));
+	return {Simd::load(values), Simd::load(values + 4)};
+}
+
+/**
+ * Create coordinates from the given lanes, bypassing the range check of the constructor
+ */
+inline auto fromLanes(CoordinateLanes lanes) noexcept -> Coordinates {
+	alignas(16) float values[8];
+	Simd::store(values, lanes.low);
+	Simd::store(values + 4, lanes.high);
+
+	auto coordinates = Coordinates{};
+	std::memcpy(&coordinates, values, sizeof(values));
+	return coordinates;
+}
+
+inline auto uniformTolerance(float tolerance) noexcept -> CoordinateLanes {
+	return {Simd::set(tolerance, tolerance, tolerance, tolerance), Simd::set(tolerance, tolerance, 1.0f, 1.0f)};
+}
+
+inline auto rangeTolerance() noexcept -> CoordinateLanes {
+	auto constexpr position = Coordinates::positionDelta;
+	auto constexpr rotation = Coordinates::rotationDelta;
+	return {Simd::set(position, position, position, rotation), Simd::set(rotation, rotation, 1.0f, 1.0f)};
+}
+
+/**
+ * Check whether every lane of the two poses differs by less than the respective lane of the tolerance
+ */
+inline auto isWithin(CoordinateLanes const &lhs, CoordinateLanes const &rhs, CoordinateLanes const &tolerance) noexcept
+    -> bool {
+	auto const low = Simd::lessThan(Simd::abs(Simd::sub(lhs.low, rhs.low)), tolerance.low);
+	auto const high = Simd::lessThan(Simd::abs(Simd::sub(lhs.high, rhs.high)), tolerance.high);
+	return Simd::all(Simd::both(low, high));
 }
 
+} // namespace Detail
+
+inline auto Coordinates::isZero() const -> bool {
+	auto const zero = Detail::CoordinateLanes{Simd::set(0.0f, 0.0f, 0.0f, 0.0f), Simd::set(0.0f, 0.0f, 0.0f, 0.0f)};
+	return Detail::isWithin(Detail::toLanes(*this), zero, Detail::uniformTolerance(epsilon));
+}
+
+/**
+ * Check whether the two poses are within Coordinates::positionDelta in position and Coordinates::rotationDelta in
+ * orientation of each other
+ */
 inline auto isInRange(Coordinates const &lhs, Coordinates const &rhs) {
-	return std::fabs(lhs.x - rhs.x) < Coordinates::positionDelta &&
-	    std::fabs(lhs.y - rhs.y) < Coordinates::positionDelta &&
-	    std::fabs(lhs.z - rhs.z) < Coordinates::positionDelta &&
-	    std::fabs(lhs.pitch - rhs.pitch) < Coordinates::rotationDelta &&
-	    std::fabs(lhs.yaw - rhs.yaw) < Coordinates::rotationDelta &&
-	    std::fabs(lhs.roll - rhs.roll) < Coordinates::rotationDelta;
+	return Detail::isWithin(Detail::toLanes(lhs), Detail::toLanes(rhs), Detail::rangeTolerance());
 }
 
 inline auto operator==(Coordinates const &lhs, Coordinates const &rhs) -> bool {
-	return isEqualFloat(lhs.x, rhs.x) && isEqualFloat(lhs.y, rhs.y) && isEqualFloat(lhs.z, rhs.z) &&
-	    isEqualFloat(lhs.pitch, rhs.pitch) && isEqualFloat(lhs.yaw, rhs.yaw) && isEqualFloat(lhs.roll, rhs.roll);
+	return Detail::isWithin(
+	    Detail::toLanes(lhs), Detail::toLanes(rhs), Detail::uniformTolerance(Coordinates::epsilon));
 }
 
 inline auto operator!=(Coordinates const &lhs, Coordinates const &rhs) -> bool {
 	return !(lhs == rhs);
 }
 
+/**
+ * Add two poses lane by lane
+ *
+ * @note The result is not range checked, since it is usually used as an offset
+ */
+inline auto operator+(Coordinates const &lhs, Coordinates const &rhs) -> Coordinates {
+	auto const left = Detail::toLanes(lhs);
+	auto const right = Detail::toLanes(rhs);
+	return Detail::fromLanes({Simd::add(left.low, right.low), Simd::add(left.high, right.high)});
+}
+
+/**
+ * Subtract two poses lane by lane
+ *
+ * @note The result is not range checked, since it is usually used as an offset
+ */
+inline auto operator-(Coordinates const &lhs, Coordinates const &rhs) -> Coordinates {
+	auto const left = Detail::toLanes(lhs);
+	auto const right = Detail::toLanes(rhs);
+	return Detail::fromLanes({Simd::sub(left.low, right.low), Simd::sub(left.high, right.high)});
+}
+
+/**
+ * Get the euclidean distance between the positions of two poses, ignoring their orientation
+ */
+inline auto distance(Coordinates const &lhs, Coordinates const &rhs) -> float {
+	auto const left = Detail::toLanes(lhs);
+	auto const right = Detail::toLanes(rhs);
+	auto const difference = Simd::sub(left.low, right.low);
+
+	alignas(16) float squares[4];
+	Simd::store(squares, Simd::mul(difference, difference));
+	return std::sqrt(squares[0] + squares[1] + squares[2]);
+}
+
+/**
+ * Find the first of the given targets that is in range of the given position
+ *
+ * @return The iterator to the first target in range, or @p last if there is none
+ */
+template<typename Iterator>
+auto findInRange(Coordinates const &position, Iterator first, Iterator last) -> Iterator {
+	auto const reference = Detail::toLanes(position);
+	auto const tolerance = Detail::rangeTolerance();
+	return std::find_if(first, last, [&](Coordinates const &target) {
+		return Detail::isWithin(reference, Detail::toLanes(target), tolerance);
+	});
+}
+
+/**
+ * Find the target whose position is closest to the given position
+ *
+ * @return The iterator to the nearest target, or @p last if there are no targets
+ */
+template<typename Iterator>
+auto findNearest(Coordinates const &position, Iterator first, Iterator last) -> Iterator {
+	auto const reference = Detail::toLanes(position).low;
+	auto nearest = last;
+	auto nearestDistance = 0.0f;
+
+	for (; first != last; ++first) {
+		auto const difference = Simd::sub(Detail::toLanes(*first).low, reference);
+		alignas(16) float squares[4];
+		Simd::store(squares, Simd::mul(difference, difference));
+
+		auto const squaredDistance = squares[0] + squares[1] + squares[2];
+		if (nearest == last || squaredDistance < nearestDistance) {
+			nearest = first;
+			nearestDistance = squaredDistance;
+		}
+	}
+
+	return nearest;
+}
+
 inline auto operator<<(std::ostream &out, Coordinates const &coordinates) -> std::ostream & {
 	out << "Coordinates{x=" << coordinates.x << ", y=" << coordinates.y << ", z=" << coordinates.z
 	    << ", pitch=" << coordinates.pitch << ", yaw=" << coordinates.yaw << ", roll=" << coordinates.roll << '}';
@@ -122,4 +317,11 @@ inline auto operator<<(std::ostream &out, Coordinates const &coordinates) -> std
 
 } // namespace KinovaZED::Hw
 
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::CoordinateError const &error) -> std::string;
+
+} // namespace KinovaZED
+
 #endif
@@ -0,0 +1,110 @@
+#ifndef INCLUDE_HW_CURRENT_MONITOR_H_
+#define INCLUDE_HW_CURRENT_MONITOR_H_
+
+#include <array>
+#include <cstddef>
+
+namespace KinovaZED::Hw {
+
+/**
+ * Windowed statistics of the six joint currents of an arm, assessed against per-joint limits
+ *
+ * The monitor keeps the most recent samples in a fixed-size window, and computes the moving average, variance and
+ * slope of every joint over that window. Limits are checked against averages instead of single samples, so a single
+ * noisy reading does not trip them. A soft limit is also reported if the current trend of a joint is predicted to
+ * cross its hard limit within the prediction horizon.
+ */
+struct CurrentMonitor {
+	auto constexpr static jointCount = std::size_t{6};
+	auto constexpr static windowSize = std::size_t{16};
+
+	using JointCurrents = std::array<float, jointCount>;
+
+	struct Limits {
+		/**
+		 * The per-joint average currents in ampere above which movements are slowed down or paused
+		 */
+		JointCurrents soft{1.5f, 1.5f, 1.5f, 1.0f, 1.0f, 1.0f};
+
+		/**
+		 * The per-joint average currents in ampere above which the arm is shut down
+		 */
+		JointCurrents hard{2.5f, 2.5f, 2.5f, 1.5f, 1.5f, 1.5f};
+
+		/**
+		 * The limits for the sum of all joint currents
+		 */
+		float totalSoft{3.5f};
+		float totalHard{4.5f};
+
+		/**
+		 * How many of the most recent samples need to exceed a hard limit on average before it trips
+		 */
+		std::size_t confirmationSamples{3};
+
+		/**
+		 * How many samples ahead the trend of each joint is extrapolated
+		 */
+		std::size_t predictionHorizon{10};
+	};
+
+	enum struct Level {
+		Normal,
+		Soft,
+		Hard,
+	};
+
+	CurrentMonitor();
+	explicit CurrentMonitor(Limits limits);
+
+	/**
+	 * Add a new sample to the window, replacing the oldest one once the window is full, and assess the result
+	 */
+	auto record(JointCurrents const &currents) noexcept -> Level;
+
+	/**
+	 * Drop all samples
+	 */
+	auto reset() noexcept -> void;
+
+	auto setLimits(Limits limits) noexcept -> void;
+
+	auto level() const noexcept -> Level;
+	auto size() const noexcept -> std::size_t;
+
+	/**
+	 * Get the average current of every joint over the whole window
+	 */
+	auto mean() const noexcept -> JointCurrents const &;
+
+	/**
+	 * Get the average current of every joint over the most recent confirmation samples
+	 */
+	auto recentMean() const noexcept -> JointCurrents const &;
+
+	auto variance() const noexcept -> JointCurrents const &;
+
+	/**
+	 * Get the least-squares slope of every joint's current in ampere per sample
+	 */
+	auto slope() const noexcept -> JointCurrents const &;
+
+  private:
+	auto updateStatistics() noexcept -> void;
+	auto assess() const noexcept -> Level;
+
+	Limits limits;
+	std::array<JointCurrents, windowSize> samples{};
+	std::size_t count{};
+	std::size_t next{};
+
+	JointCurrents means{};
+	JointCurrents recentMeans{};
+	JointCurrents variances{};
+	JointCurrents slopes{};
+	Level currentLevel{Level::Normal};
+};
+
+} // namespace KinovaZED::Hw
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef INCLUDE_HW_JOYSTICK_MAILBOX_H_
+#define INCLUDE_HW_JOYSTICK_MAILBOX_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace KinovaZED::Hw {
+
+/**
+ * A single-slot, latest-wins mailbox for joystick deflections
+ *
+ * Posting a new deflection replaces any deflection that has not been taken yet. Both posting and taking are wait-free
+ * and can happen from any thread.
+ */
+struct JoystickMailbox {
+	struct Deflection {
+		int x;
+		int y;
+		int z;
+	};
+
+	/**
+	 * Post a new deflection
+	 *
+	 * @return true iff a pending deflection was replaced
+	 */
+	auto post(Deflection deflection) noexcept -> bool {
+		auto previous = slot.exchange(pack(deflection), std::memory_order_acq_rel);
+		return previous & pendingFlag;
+	}
+
+	/**
+	 * Take the pending deflection, if there is one
+	 */
+	auto take() noexcept -> std::optional<Deflection> {
+		auto packed = slot.exchange(0, std::memory_order_acq_rel);
+		if (!(packed & pendingFlag)) {
+			return std::nullopt;
+		}
+		return unpack(packed);
+	}
+
+	/**
+	 * Drop the pending deflection, if there is one
+	 */
+	auto clear() noexcept -> void {
+		slot.store(0, std::memory_order_release);
+	}
+
+  private:
+	auto constexpr static pendingFlag = std::uint64_t{1} << 48;
+
+	auto static pack(Deflection deflection) noexcept -> std::uint64_t {
+		auto component = [](int value, int shift) {
+			auto clamped = std::clamp<int>(
+			    value, std::numeric_limits<std::int16_t>::min(), std::numeric_limits<std::int16_t>::max());
+			return std::uint64_t{static_cast<std::uint16_t>(clamped)} << shift;
+		};
+		return component(deflection.x, 0) | component(deflection.y, 16) | component(deflection.z, 32) | pendingFlag;
+	}
+
+	auto static unpack(std::uint64_t packed) noexcept -> Deflection {
+		auto component = [packed](int shift) {
+			return static_cast<int>(static_cast<std::int16_t>(static_cast<std::uint16_t>(packed >> shift)));
+		};
+		return {component(0), component(16), component(32)};
+	}
+
+	std::atomic<std::uint64_t> slot{};
+};
+
+} // namespace KinovaZED::Hw
+
+#endif
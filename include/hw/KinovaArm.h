@@ -3,30 +3,128 @@
 
 #include "hw/Actor.h"
 #include "hw/Coordinates.h"
+#include "hw/CurrentMonitor.h"
+#include "hw/JoystickMailbox.h"
+#include "hw/Reconnector.h"
+#include "hw/StepSequencer.h"
+#include "hw/TelemetryRecorder.h"
+#include "hw/TransactionStatistics.h"
+#include "hw/UpdateStatistics.h"
+#include "support/ExecutorPool.h"
+#include "support/Expected.h"
+#include "support/HistoryRing.h"
 #include "support/Logging.h"
+#include "support/SeqLock.h"
 
 #include "libkindrv/kindrv.h"
 
-#include <asio/executor_work_guard.hpp>
 #include <asio/io_context.hpp>
 #include <asio/io_context_strand.hpp>
 #include <asio/steady_timer.hpp>
 
+#include <array>
 #include <chrono>
-#include <future>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace KinovaZED::Hw {
 
 
 struct KinovaArm : Actor, LoggingMixin {
+	/**
+	 * The policy that determines how often the state of the arm is polled via USB
+	 */
+	struct PollingPolicy {
+		/**
+		 * The polling period while the arm is moving, changing its steering mode or receiving commands
+		 */
+		std::chrono::milliseconds activePeriod{10};
+
+		/**
+		 * The polling period while the arm is idle, retracted or frozen
+		 */
+		std::chrono::milliseconds idlePeriod{100};
+
+		/**
+		 * How long to keep polling at the active rate after the last command was received
+		 */
+		std::chrono::milliseconds commandHoldTime{2000};
+
+		/**
+		 * How many USB reads a single state update may perform at most
+		 *
+		 * Signals that are due but exceed the budget are read during one of the following updates, most overdue first.
+		 */
+		std::size_t maximumReadsPerUpdate{2};
+
+		/**
+		 * How often to log the effective polling rate, the update loop timing and the CPU time spent on state updates
+		 */
+		std::chrono::seconds reportInterval{60};
+	};
+
+	using ReconnectPolicy = Hw::ReconnectPolicy;
+
+	/**
+	 * A snapshot of the arm's telemetry as seen by a single state update
+	 */
+	struct TelemetrySample {
+		std::chrono::steady_clock::time_point timestamp{};
+		Coordinates position{};
+		std::array<float, 6> jointCurrents{};
+		std::array<float, 6> jointVelocities{};
+	};
+
+	using TelemetryHistory = HistoryRing<TelemetrySample, 1024>;
+
 	explicit KinovaArm(Logger logger);
 	KinovaArm(Coordinates homePosition, Logger logger);
+
+	/**
+	 * Create an arm that runs on a shared executor pool instead of its own thread
+	 *
+	 * @note The pool must outlive the arm
+	 */
+	KinovaArm(ExecutorPool &executor, Logger logger);
+	KinovaArm(ExecutorPool &executor, Coordinates homePosition, Logger logger);
 	~KinovaArm();
 
+	/**
+	 * Replace the state polling policy
+	 */
+	auto setPollingPolicy(PollingPolicy policy) -> void;
+
+	/**
+	 * Replace the reconnection policy
+	 */
+	auto setReconnectPolicy(ReconnectPolicy policy) -> void;
+
+	/**
+	 * Replace the joint current limits
+	 */
+	auto setCurrentLimits(CurrentMonitor::Limits limits) -> void;
+
+	/**
+	 * Set the period at which the most recent joystick input is sent to the arm
+	 *
+	 * Joystick inputs that arrive faster than this are coalesced, only the latest one is sent.
+	 */
+	auto setJoystickOutputPeriod(std::chrono::milliseconds period) -> void;
+
+	/**
+	 * Get the recent telemetry samples of the arm
+	 *
+	 * The history can safely be read from any thread while the arm keeps recording new samples.
+	 */
+	auto getTelemetryHistory() const -> TelemetryHistory const &;
+
   private:
 	enum struct RetractionMode {
 		NormalToReady,
@@ -46,6 +144,7 @@ struct KinovaArm : Actor, LoggingMixin {
 		Retracting,
 		HomeToRetract,
 		Initializing,
+		PausedForCurrent,
 	};
 
 	enum struct RetractionStatus {
@@ -69,48 +168,132 @@ struct KinovaArm : Actor, LoggingMixin {
 		std::optional<RetractionStatus> retractionStatus;
 
 		float fullCurrent{};
+		std::array<float, 6> jointCurrents{};
+		std::array<float, 6> jointVelocities{};
 
 		bool hasControl{};
+		bool isCurrentLimited{};
 		bool wasHomed{};
 		bool isInFailState{};
 	};
 
-	KinovaArm(std::optional<Coordinates> origin, Logger logger);
+	struct PollingStatistics {
+		std::chrono::steady_clock::time_point windowStart{std::chrono::steady_clock::now()};
+		std::size_t activeUpdates{};
+		std::chrono::nanoseconds cpuTime{};
+		UpdateStatistics timing{};
+		TransactionStatistics transactions{};
+	};
+
+	/**
+	 * A signal that is read from the arm with its own rate
+	 *
+	 * While its activation condition holds, the signal is read every active period. Otherwise it is read every idle
+	 * period, or not at all if the idle period is zero. A signal without activation condition is always active.
+	 */
+	struct TelemetrySignal {
+		char const *name;
+		std::chrono::milliseconds activePeriod;
+		std::chrono::milliseconds idlePeriod;
+		bool (KinovaArm::*isActive)() const;
+		void (KinovaArm::*read)();
+		std::chrono::steady_clock::time_point lastRead{};
+	};
+
+	KinovaArm(ExecutorPool *executor, std::optional<Coordinates> origin, Logger logger);
 
 	/// @section Actor Interface Implementation
 
-	auto doConnect(std::promise<bool> token) -> void override;
-	auto doDisconnect(std::promise<void> token) -> void override;
-	auto doTakeControl(std::promise<bool> token) -> void override;
-	auto doReleaseControl(std::promise<bool> token) -> void override;
-	auto doInitialize(std::promise<void> token) -> void override;
-	auto doStopMoving(std::promise<bool> token) -> void override;
-	auto doHome(std::promise<void> token) -> void override;
-	auto doRetract(std::promise<void> token) -> void override;
-	auto doMoveTo(Coordinates position, std::promise<void> token) -> void override;
-	auto doSetJoystick(int x, int y, int z, std::promise<void> token) -> void override;
-	auto doSetSteeringMode(SteeringMode mode, std::promise<bool> token) -> void override;
-	auto doHasFailed(std::promise<bool> token) const -> void override;
-	auto doGetPosition(std::promise<Coordinates> token) const -> void override;
-	auto doGetSteeringMode(std::promise<std::optional<SteeringMode>> token) const -> void override;
+	auto doConnect(CompletionHandler<bool> handler) -> void override;
+	auto doDisconnect(CompletionHandler<> handler) -> void override;
+	auto doTakeControl(CompletionHandler<bool> handler) -> void override;
+	auto doReleaseControl(CompletionHandler<bool> handler) -> void override;
+	auto doInitialize(CompletionHandler<> handler) -> void override;
+	auto doStopMoving(CompletionHandler<bool> handler) -> void override;
+	auto doHome(CompletionHandler<> handler) -> void override;
+	auto doRetract(CompletionHandler<> handler) -> void override;
+	auto doMoveTo(Coordinates position, CompletionHandler<> handler) -> void override;
+	auto doAppendTarget(Coordinates position, CompletionHandler<> handler) -> void override;
+	auto doSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void override;
+	auto doSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void override;
+	auto doHasFailed(CompletionHandler<bool> handler) const -> void override;
+	auto doGetPosition(CompletionHandler<Coordinates> handler) const -> void override;
+	auto doGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void override;
+	auto doGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void override;
+	auto doGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void override;
+	auto doSetTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void override;
 
 	/// @section Kinova Arm Implementation
 
 	auto scheduleStateUpdate() -> void;
+	auto awaitStateUpdate() -> void;
 	auto performStateUpdate() -> void;
 	auto stopUpdateLoop() -> void;
 
+	auto selectPollingPeriod() const -> std::chrono::milliseconds;
+	auto expeditePolling() -> void;
+	auto resetTelemetrySchedule() -> void;
+	auto readDueTelemetry() -> void;
+	auto nextReadOf(TelemetrySignal const &signal) const -> std::optional<std::chrono::steady_clock::time_point>;
+	auto needsFastPositionUpdates() const -> bool;
+	auto needsRetractionModeUpdates() const -> bool;
+	auto needsMovementCheck() const -> bool;
+
+	auto recordUpdateTick(std::chrono::nanoseconds lateness, std::uint64_t skippedTicks) -> void;
+	auto recordPollingStatistics(std::chrono::nanoseconds wallTime, std::chrono::nanoseconds cpuTime) -> void;
+	auto recordTransaction(Transaction transaction, std::chrono::steady_clock::time_point start, bool failed) -> void;
+
+	/**
+	 * Perform a single USB transaction with the arm, and record its latency and whether it failed
+	 */
+	template<typename Call>
+	auto transact(Transaction transaction, Call &&call) -> std::invoke_result_t<Call> {
+		ensureConnected();
+		auto const start = std::chrono::steady_clock::now();
+		try {
+			if constexpr (std::is_void_v<std::invoke_result_t<Call>>) {
+				call();
+				recordTransaction(transaction, start, false);
+			} else {
+				auto result = call();
+				recordTransaction(transaction, start, false);
+				return result;
+			}
+		} catch (...) {
+			recordTransaction(transaction, start, true);
+			throw;
+		}
+	}
+
+	auto startJoystickOutput() -> void;
+	auto emitJoystickOutput() -> void;
+
+	auto recordTelemetrySample() -> void;
+	auto dumpTelemetryHistory(std::chrono::seconds span) -> void;
+
 	auto checkCurrents() -> void;
+	auto handleCurrentLevel(CurrentMonitor::Level level) -> void;
+	auto tripOvercurrentProtection() -> void;
+	auto pauseMovement() -> void;
+	auto resumeMovement() -> void;
 	auto checkMovement() -> void;
 	auto updatePosition() -> void;
-	auto readPosition() -> Coordinates;
+	auto readPosition() -> Expected<Coordinates, CoordinateError>;
 	auto handlePosition(Coordinates newPosition) -> void;
 	auto updateRetractionMode() -> void;
 	auto readRetractionMode() -> RetractionMode;
 	auto handleRetractionMode(RetractionMode newMode) -> void;
 	auto updateSteeringMode() -> void;
 
-	auto reconnectOnError() -> void;
+	auto openConnection() -> void;
+	auto closeConnection() -> void;
+	auto ensureConnected() const -> void;
+
+	auto startReconnecting() -> void;
+	auto stopReconnecting() -> void;
+	auto restoreConnectionState(bool restoreControl, std::optional<SteeringMode> restoreSteeringMode) -> void;
+
+	auto publishState() -> void;
 
 	auto moveToHardwareHome() -> void;
 	auto moveToSoftwareHome() -> void;
@@ -127,17 +310,57 @@ struct KinovaArm : Actor, LoggingMixin {
 	auto logError(std::string function, std::string format, Args &&... args) {
 		LoggingMixin::template logError(function, format, std::forward<Args>(args)...);
 		state->isInFailState = true;
+		publishState();
 	}
 
-	asio::io_context ioContext{};
+	std::unique_ptr<ExecutorPool> ownExecutor;
+	asio::io_context &ioContext;
 	asio::io_context::strand actionStrand{ioContext};
 	asio::steady_timer stateUpdateTimer{actionStrand};
-	std::future<void> ioRunner{};
+	asio::steady_timer joystickOutputTimer{actionStrand};
+	StepSequencer sequencer;
+	Reconnector reconnector{actionStrand};
 	std::optional<KinDrv::JacoArm> arm{};
 	std::optional<VolatileState> state{};
+	SeqLock<VolatileState> publishedState{};
+	std::deque<Coordinates> queuedTargets{};
+	std::deque<Coordinates> pausedTargets{};
+	CurrentMonitor currentMonitor{};
+	TelemetryHistory telemetryHistory{};
+	std::shared_ptr<TelemetryRecorder> telemetryRecorder{};
+
+	PollingPolicy pollingPolicy{};
+	PollingStatistics pollingStatistics{};
+	std::chrono::milliseconds pollingPeriod{pollingPolicy.activePeriod};
+	std::chrono::steady_clock::time_point updateDeadline{};
+	UpdateStatistics updateStatistics{};
+	TransactionStatistics transactionStatistics{};
+	std::chrono::steady_clock::time_point lastCommand{};
+
+	JoystickMailbox joystickMailbox{};
+	std::chrono::milliseconds joystickOutputPeriod{10};
+	bool isJoystickOutputActive{};
+
+	std::array<TelemetrySignal, 4> telemetrySignals{{
+	    {"position",
+	     std::chrono::milliseconds{10},
+	     std::chrono::milliseconds{100},
+	     &KinovaArm::needsFastPositionUpdates,
+	     &KinovaArm::updatePosition},
+	    {"retraction mode",
+	     std::chrono::milliseconds{10},
+	     std::chrono::milliseconds{1000},
+	     &KinovaArm::needsRetractionModeUpdates,
+	     &KinovaArm::updateRetractionMode},
+	    {"currents", std::chrono::milliseconds{50}, std::chrono::milliseconds{50}, nullptr, &KinovaArm::checkCurrents},
+	    {"velocities",
+	     std::chrono::milliseconds{100},
+	     std::chrono::milliseconds{0},
+	     &KinovaArm::needsMovementCheck,
+	     &KinovaArm::checkMovement},
+	}};
 
 	std::optional<Coordinates> const homePosition;
-	asio::executor_work_guard<asio::io_context::executor_type> ioWorkGuard;
 };
 
 } // namespace KinovaZED::Hw
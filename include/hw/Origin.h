@@ -2,29 +2,45 @@
 #define INCLUDE_HW_ORIGIN_H_
 
 #include "hw/Coordinates.h"
+#include "math/Matrix.h"
+#include "math/Pose.h"
 
 namespace KinovaZED::Hw {
 
-using f2d_vec_t = std::vector<std::vector<float>>;
-
-struct Origin {
-	Origin();
-	explicit Origin(Coordinates const &origin);
+/**
+ * The frame of an objective, relative to the base of the arm
+ *
+ * Origins of the arm-facing path use float. Origins with a scalar type of double are available for long chains of
+ * transformations and for capturing positions relative to an origin.
+ */
+template<typename ScalarType>
+struct BasicOrigin {
+	BasicOrigin();
+	explicit BasicOrigin(Coordinates const &origin);
 
 	auto isZero() const -> bool;
 	auto getCoordinates() const -> Coordinates const &;
-	auto getTransformationMatrix() const -> f2d_vec_t const &;
-	auto getInvertedTransformationMatrix() const -> f2d_vec_t const &;
+	auto getTransformationMatrix() const -> Matrix<4, 4, ScalarType> const &;
+	auto getInvertedTransformationMatrix() const -> Matrix<4, 4, ScalarType> const &;
+	auto getPose() const -> BasicPose<ScalarType> const &;
+	auto getInvertedPose() const -> BasicPose<ScalarType> const &;
 
-	auto operator==(Origin const &other) const -> bool;
-	auto operator!=(Origin const &other) const -> bool;
+	auto operator==(BasicOrigin const &other) const -> bool;
+	auto operator!=(BasicOrigin const &other) const -> bool;
 
   private:
 	Coordinates origin;
-	f2d_vec_t transformationMatrix;
-	f2d_vec_t invertedTransformationMatrix;
+	BasicPose<ScalarType> pose;
+	BasicPose<ScalarType> invertedPose;
+	Matrix<4, 4, ScalarType> transformationMatrix;
+	Matrix<4, 4, ScalarType> invertedTransformationMatrix;
 };
 
+extern template struct BasicOrigin<float>;
+extern template struct BasicOrigin<double>;
+
+using Origin = BasicOrigin<float>;
+
 } // namespace KinovaZED::Hw
 
 #endif
\ No newline at end of file
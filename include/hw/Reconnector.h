@@ -0,0 +1,117 @@
+#ifndef INCLUDE_HW_RECONNECTOR_H_
+#define INCLUDE_HW_RECONNECTOR_H_
+
+#include "hw/ConnectionStatistics.h"
+
+#include <asio/io_context_strand.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <random>
+
+namespace KinovaZED::Hw {
+
+/**
+ * The policy that determines how the connection to an arm is restored after a critical error
+ */
+struct ReconnectPolicy {
+	/**
+	 * The delay before the first reconnection attempt, which doubles with every failed attempt
+	 */
+	std::chrono::milliseconds initialDelay{100};
+
+	/**
+	 * The upper bound of the delay between two reconnection attempts
+	 */
+	std::chrono::milliseconds maximumDelay{5000};
+
+	/**
+	 * The fraction (0.0 to 1.0) by which each delay is randomly shortened, so that retries do not run in lockstep
+	 */
+	double jitter{0.2};
+
+	/**
+	 * How many attempts to make before giving up, or 0 to keep trying forever
+	 */
+	std::size_t maximumAttempts{0};
+
+	/**
+	 * Get the delay before the next attempt, after the given number of attempts have already failed
+	 */
+	auto delayFor(std::size_t attempts, std::minstd_rand &random) const -> std::chrono::milliseconds;
+};
+
+/**
+ * Restores a lost connection with exponentially growing delays between the attempts
+ *
+ * The attempts are run on a timer, so the strand stays free to handle other work while waiting for the next one.
+ *
+ * @note All member functions must be called on the strand the reconnector was created with.
+ */
+struct Reconnector {
+	using Attempt = std::function<void()>;
+	using FailureHandler = std::function<void(std::size_t attempt, std::exception const &error)>;
+	using Completion = std::function<void(bool reconnected, std::size_t attempts)>;
+
+	explicit Reconnector(asio::io_context::strand &strand);
+
+	/**
+	 * Replace the reconnection policy, which takes effect with the next scheduled attempt
+	 */
+	auto setPolicy(ReconnectPolicy policy) -> void;
+
+	/**
+	 * Start trying to reconnect using the given attempt, which signals failure by throwing
+	 *
+	 * The failure handler is called after every failed attempt. The completion is called once the attempt succeeded,
+	 * or once the policy's maximum number of attempts has failed.
+	 *
+	 * @return false if the reconnector was already active, in which case nothing is started
+	 */
+	auto start(Attempt attempt, FailureHandler failureHandler, Completion completion) -> bool;
+
+	/**
+	 * Stop reconnecting without calling the completion
+	 *
+	 * @return The number of attempts that were made
+	 */
+	auto stop() -> std::size_t;
+
+	/**
+	 * Check if the reconnector is currently trying to reconnect
+	 */
+	auto isActive() const -> bool;
+
+	/**
+	 * Get the statistics of all reconnection attempts made so far
+	 */
+	auto getStatistics() const -> ConnectionStatistics const &;
+
+  private:
+	struct Pending {
+		Attempt attempt;
+		FailureHandler failureHandler;
+		Completion completion;
+		std::chrono::steady_clock::time_point lostAt;
+		std::size_t attempts{};
+	};
+
+	auto scheduleAttempt() -> void;
+	auto runAttempt() -> void;
+
+	asio::steady_timer retryTimer;
+	ReconnectPolicy policy{};
+	std::optional<Pending> pending{};
+	ConnectionStatistics statistics{};
+	std::minstd_rand random{std::random_device{}()};
+	std::uint64_t generation{};
+};
+
+} // namespace KinovaZED::Hw
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef INCLUDE_HW_SIMULATED_ARM_H_
+#define INCLUDE_HW_SIMULATED_ARM_H_
+
+#include "hw/Actor.h"
+#include "hw/Coordinates.h"
+#include "hw/CurrentMonitor.h"
+#include "hw/Reconnector.h"
+#include "hw/TelemetryRecorder.h"
+#include "hw/TransactionStatistics.h"
+#include "hw/UpdateStatistics.h"
+#include "support/ExecutorPool.h"
+#include "support/Logging.h"
+
+#include <asio/io_context.hpp>
+#include <asio/io_context_strand.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+
+namespace KinovaZED::Hw {
+
+/**
+ * An actor that simulates a Jaco arm without any hardware
+ *
+ * The simulated arm moves with a limited cartesian speed, goes through the same retraction modes as the real arm while
+ * initializing, homing and retracting, and fires the same events as the real arm. Every simulated USB transaction
+ * blocks the arm's strand for a configurable time, so that the timing behavior of the real arm can be approximated.
+ */
+struct SimulatedArm : Actor, LoggingMixin {
+	/**
+	 * The time it takes to complete each of the simulated USB transactions
+	 */
+	struct TransactionLatencies {
+		std::chrono::microseconds connect{50000};
+		std::chrono::microseconds control{1000};
+		std::chrono::microseconds readPosition{1000};
+		std::chrono::microseconds readStatus{1000};
+		std::chrono::microseconds readCurrents{1000};
+		std::chrono::microseconds readVelocities{1000};
+		std::chrono::microseconds setTarget{1000};
+		std::chrono::microseconds moveJoystick{1000};
+		std::chrono::microseconds pushButton{1000};
+		std::chrono::microseconds releaseJoystick{1000};
+		std::chrono::microseconds eraseTrajectories{1000};
+	};
+
+	/**
+	 * The kinematic model of the simulated arm
+	 */
+	struct Model {
+		/**
+		 * The maximum cartesian speed in meters per second
+		 */
+		float maximumSpeed{0.2f};
+
+		/**
+		 * The maximum rotational speed in radians per second
+		 */
+		float maximumAngularSpeed{0.6f};
+
+		Coordinates hardwareHome{0.21f, -0.26f, 0.5f, 1.65f, 1.11f, 0.12f};
+		Coordinates retractionPoint{0.0f, -0.24f, 0.25f, 1.6f, 1.2f, 0.0f};
+
+		/**
+		 * How long it takes until a steering mode change is reported as finished
+		 */
+		std::chrono::milliseconds steeringModeDelay{500};
+
+		/**
+		 * The period of the simulation loop, which also polls the simulated arm like KinovaArm polls the real one
+		 */
+		std::chrono::milliseconds stepPeriod{10};
+
+		TransactionLatencies latencies{};
+	};
+
+	explicit SimulatedArm(Logger logger);
+	SimulatedArm(Model model, Logger logger);
+
+	/**
+	 * Create a simulated arm that runs on a shared executor pool instead of its own thread
+	 *
+	 * @note The simulated USB transactions block one of the pool's threads while they take place
+	 */
+	SimulatedArm(ExecutorPool &executor, Model model, Logger logger);
+	~SimulatedArm();
+
+	/**
+	 * Replace the reconnection policy
+	 */
+	auto setReconnectPolicy(ReconnectPolicy policy) -> void;
+
+	/**
+	 * Replace the joint current limits
+	 */
+	auto setCurrentLimits(CurrentMonitor::Limits limits) -> void;
+
+	/**
+	 * Set the joint currents the simulated arm reports from now on
+	 *
+	 * Like the real arm, the simulated arm shuts down once the currents exceed their hard limits. It does not slow
+	 * down when only the soft limits are exceeded.
+	 */
+	auto simulateJointCurrents(CurrentMonitor::JointCurrents currents) -> void;
+
+	/**
+	 * Simulate a critical USB error that drops the connection to the arm
+	 *
+	 * The given number of following connection attempts fail as well. If the arm should reconnect on errors, it
+	 * restores the connection like the real arm does, otherwise it stays in the failed state.
+	 */
+	auto simulateConnectionLoss(std::size_t failingAttempts = 0) -> void;
+
+  private:
+	enum struct RetractionMode {
+		NormalToReady,
+		ReadyToStandby,
+		ReadyToRetract,
+		RetractToStandby,
+		RetractToReady,
+		Normal,
+		NoInitToReady,
+	};
+
+	enum struct Goal {
+		Initialize,
+		Home,
+		Retract,
+	};
+
+	SimulatedArm(ExecutorPool *executor, Model model, Logger logger);
+
+	/// @section Actor Interface Implementation
+
+	auto doConnect(CompletionHandler<bool> handler) -> void override;
+	auto doDisconnect(CompletionHandler<> handler) -> void override;
+	auto doTakeControl(CompletionHandler<bool> handler) -> void override;
+	auto doReleaseControl(CompletionHandler<bool> handler) -> void override;
+	auto doInitialize(CompletionHandler<> handler) -> void override;
+	auto doStopMoving(CompletionHandler<bool> handler) -> void override;
+	auto doHome(CompletionHandler<> handler) -> void override;
+	auto doRetract(CompletionHandler<> handler) -> void override;
+	auto doMoveTo(Coordinates position, CompletionHandler<> handler) -> void override;
+	auto doAppendTarget(Coordinates position, CompletionHandler<> handler) -> void override;
+	auto doSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void override;
+	auto doSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void override;
+	auto doHasFailed(CompletionHandler<bool> handler) const -> void override;
+	auto doGetPosition(CompletionHandler<Coordinates> handler) const -> void override;
+	auto doGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void override;
+	auto doGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void override;
+	auto doGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void override;
+	auto doSetTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void override;
+
+	/// @section Simulation
+
+	auto openConnection() -> void;
+	auto closeConnection() -> void;
+	auto startReconnecting() -> void;
+	auto stopReconnecting() -> void;
+	auto restoreConnectionState(bool restoreControl, std::optional<SteeringMode> restoreSteeringMode) -> void;
+
+	auto transact(std::chrono::microseconds latency) -> void;
+	auto transact(Transaction transaction, std::chrono::microseconds latency) -> void;
+	auto scheduleStep() -> void;
+	auto performStep(std::chrono::duration<float> elapsed) -> void;
+	auto moveTowards(Coordinates const &destination, std::chrono::duration<float> elapsed) -> bool;
+	auto moveWithJoystick(std::chrono::duration<float> elapsed) -> void;
+	auto startGoal(Goal newGoal) -> void;
+	auto advanceGoal(std::chrono::duration<float> elapsed) -> void;
+	auto checkCurrents() -> bool;
+	auto finishSteeringModeChange() -> void;
+	auto recordTelemetry() -> void;
+
+	Model const model;
+
+	std::unique_ptr<ExecutorPool> ownExecutor;
+	asio::io_context &ioContext;
+	asio::io_context::strand actionStrand{ioContext};
+	asio::steady_timer stepTimer{actionStrand};
+	Reconnector reconnector{actionStrand};
+
+	Coordinates position{model.retractionPoint};
+	RetractionMode retractionMode{RetractionMode::NoInitToReady};
+	std::optional<Goal> goal{};
+	std::optional<Coordinates> target{};
+	bool targetReported{};
+	std::deque<Coordinates> queuedTargets{};
+	std::array<float, 3> joystick{};
+	std::optional<SteeringMode> steeringMode{};
+	std::optional<std::chrono::steady_clock::time_point> lastSteeringModeChange{};
+	CurrentMonitor::JointCurrents jointCurrents{};
+	CurrentMonitor currentMonitor{};
+
+	std::chrono::steady_clock::time_point stepDeadline{};
+	UpdateStatistics statistics{};
+	TransactionStatistics transactions{};
+	std::shared_ptr<TelemetryRecorder> telemetryRecorder{};
+
+	bool isConnected{};
+	bool hasControl{};
+	std::size_t failingConnects{};
+};
+
+} // namespace KinovaZED::Hw
+
+#endif
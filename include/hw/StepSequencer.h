@@ -0,0 +1,89 @@
+#ifndef INCLUDE_HW_STEP_SEQUENCER_H_
+#define INCLUDE_HW_STEP_SEQUENCER_H_
+
+#include <asio/io_context_strand.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <string>
+#include <variant>
+
+namespace KinovaZED::Hw {
+
+/**
+ * An asynchronous sequencer for timed hardware interactions
+ *
+ * Steps are executed in the order they were appended. After a step has been executed, the sequencer waits for the
+ * step's settle time using a timer, so the strand stays free to handle other work in the meantime. Steps are grouped
+ * into batches by completion markers. If a step of a batch fails, the remaining steps of that batch are skipped and
+ * the batch completion is notified of the failure.
+ *
+ * @note All member functions must be called on the strand the sequencer was created with.
+ */
+struct StepSequencer {
+	using Action = std::function<void()>;
+	using Completion = std::function<void(bool succeeded)>;
+	using FailureHandler = std::function<void(std::string const &step, std::exception const &error)>;
+
+	StepSequencer(asio::io_context::strand &strand, FailureHandler failureHandler);
+
+	/**
+	 * Append a step that runs the given action and then waits for the given settle time
+	 */
+	auto append(std::string name, Action action, std::chrono::milliseconds settleTime = {}) -> void;
+
+	/**
+	 * Append a step that only waits for the given time
+	 */
+	auto wait(std::chrono::milliseconds duration) -> void;
+
+	/**
+	 * Close the current batch and get notified once all of its steps have been executed
+	 */
+	auto notify(Completion completion) -> void;
+
+	/**
+	 * Abort all pending steps
+	 *
+	 * The completions of all aborted batches are notified of the failure.
+	 *
+	 * @return The number of steps that were dropped
+	 */
+	auto cancel() -> std::size_t;
+
+	/**
+	 * Check if there are no pending steps
+	 */
+	auto isIdle() const -> bool;
+
+  private:
+	struct Step {
+		std::string name;
+		Action action;
+		std::chrono::milliseconds settleTime;
+	};
+
+	struct Marker {
+		Completion completion;
+	};
+
+	auto enqueue(std::variant<Step, Marker> entry) -> void;
+	auto runPending() -> void;
+
+	asio::steady_timer settleTimer;
+	FailureHandler failureHandler;
+	std::deque<std::variant<Step, Marker>> pending{};
+	std::uint64_t generation{};
+	bool isRunning{};
+	bool isSettling{};
+	bool batchFailed{};
+};
+
+} // namespace KinovaZED::Hw
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef INCLUDE_HW_TELEMETRY_RECORDER_H_
+#define INCLUDE_HW_TELEMETRY_RECORDER_H_
+
+#include "hw/Coordinates.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace KinovaZED::Hw {
+
+/**
+ * A single record of the telemetry file, exactly as it is stored on disk
+ */
+struct TelemetryRecord {
+	enum Flags : std::uint8_t {
+		HasControl = 1 << 0,
+		HasFailed = 1 << 1,
+		IsCurrentLimited = 1 << 2,
+	};
+
+	/**
+	 * The value of the retraction mode and movement status fields if they are not known
+	 */
+	auto constexpr static unknown = std::uint8_t{0xff};
+
+	std::uint64_t sequence;
+	std::int64_t timestamp;
+	std::array<float, 6> position;
+	std::array<float, 6> jointCurrents;
+	std::uint8_t retractionMode;
+	std::uint8_t movementStatus;
+	std::uint8_t controllerState;
+	std::uint8_t flags;
+	std::uint32_t checksum;
+
+	/**
+	 * Compute the checksum over all fields but the checksum itself
+	 */
+	auto computeChecksum() const noexcept -> std::uint32_t;
+};
+
+static_assert(std::is_trivially_copyable_v<TelemetryRecord>, "Telemetry records must be trivially copyable!");
+static_assert(sizeof(TelemetryRecord) == 72, "The on-disk telemetry record layout must not change!");
+
+/**
+ * Records telemetry samples into a preallocated, memory mapped ring file
+ *
+ * Every record carries a sequence number and a checksum, and once the ring is full the oldest record is overwritten.
+ * Recording only copies the record into the mapping, so it neither allocates nor issues any system call. Since the
+ * mapping is shared with the page cache, records survive a crash of the process. When reopening an existing file with
+ * the same capacity, recording continues after the newest valid record.
+ */
+struct TelemetryRecorder {
+	/**
+	 * The data of a single telemetry sample
+	 */
+	struct Sample {
+		Coordinates position{};
+		std::array<float, 6> jointCurrents{};
+		std::optional<std::uint8_t> retractionMode{};
+		std::optional<std::uint8_t> movementStatus{};
+		bool hasControl{};
+		bool hasFailed{};
+		bool isCurrentLimited{};
+	};
+
+	/**
+	 * Open the ring file at the given path, creating or resizing it as needed
+	 *
+	 * @throws std::system_error if the file can not be created or mapped
+	 */
+	TelemetryRecorder(std::filesystem::path path, std::size_t capacity);
+	~TelemetryRecorder();
+
+	TelemetryRecorder(TelemetryRecorder const &) = delete;
+	TelemetryRecorder &operator=(TelemetryRecorder const &) = delete;
+
+	/**
+	 * Append a sample to the ring file
+	 *
+	 * @note Only a single thread must ever record into a given TelemetryRecorder
+	 */
+	auto record(Sample const &sample) noexcept -> void;
+
+	/**
+	 * Set the state of the controller that will be stored with all following samples
+	 *
+	 * @note This function can safely be called from any thread
+	 */
+	auto setControllerState(std::uint8_t state) noexcept -> void;
+
+	/**
+	 * Ask the kernel to start writing all recorded samples back to the file
+	 */
+	auto flush() -> void;
+
+	auto capacity() const noexcept -> std::size_t;
+
+	/**
+	 * Get the sequence number the next record will be written with
+	 */
+	auto nextSequence() const noexcept -> std::uint64_t;
+
+  private:
+	auto slot(std::uint64_t sequence) noexcept -> TelemetryRecord *;
+
+	std::size_t const slots;
+	int descriptor{-1};
+	void *mapping{};
+	std::size_t mappingSize{};
+	std::uint64_t sequence{1};
+	std::atomic<std::uint8_t> controllerState{};
+};
+
+/**
+ * Read all valid records from a telemetry ring file, oldest first
+ *
+ * Records that were torn by a crash fail their checksum and are skipped.
+ *
+ * @throws std::runtime_error if the file is not a telemetry ring file
+ */
+auto readTelemetryFile(std::filesystem::path const &path) -> std::vector<TelemetryRecord>;
+
+} // namespace KinovaZED::Hw
+
+#endif
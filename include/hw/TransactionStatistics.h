@@ -0,0 +1,70 @@
+#ifndef INCLUDE_HW_TRANSACTION_STATISTICS_H_
+#define INCLUDE_HW_TRANSACTION_STATISTICS_H_
+
+#include "support/LatencyHistogram.h"
+#include "support/ToString.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace KinovaZED::Hw {
+
+/**
+ * The kinds of USB transactions an actor performs with its arm
+ */
+enum struct Transaction {
+	GetCartesianPosition,
+	GetStatus,
+	GetAngularCurrent,
+	GetAngularVelocity,
+	SetCartesianTarget,
+	MoveJoystickAxis,
+	PushJoystickButton,
+	ReleaseJoystick,
+	EraseTrajectories,
+
+	// End Marker
+	END_OF_ENUM
+};
+
+/**
+ * Latency histograms and error counters of an actor's USB transactions, one set per kind of transaction
+ */
+struct TransactionStatistics {
+	struct Counters {
+		LatencyHistogram latencies{};
+		std::uint64_t errors{};
+	};
+
+	/**
+	 * Record a single transaction, including the ones that failed
+	 */
+	auto record(Transaction transaction, std::chrono::nanoseconds duration, bool failed) noexcept -> void;
+
+	auto operator[](Transaction transaction) const noexcept -> Counters const &;
+
+	/**
+	 * Get the accumulated time spent in transactions of all kinds
+	 */
+	auto totalTime() const noexcept -> std::chrono::nanoseconds;
+
+  private:
+	std::array<Counters, static_cast<std::size_t>(Transaction::END_OF_ENUM)> counters{};
+};
+
+} // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::Transaction const &transaction) -> std::string;
+
+template<>
+auto toString(Hw::TransactionStatistics const &statistics) -> std::string;
+
+} // namespace KinovaZED
+
+#endif
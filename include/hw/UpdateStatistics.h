@@ -0,0 +1,53 @@
+#ifndef INCLUDE_HW_UPDATE_STATISTICS_H_
+#define INCLUDE_HW_UPDATE_STATISTICS_H_
+
+#include "support/LatencyHistogram.h"
+#include "support/ToString.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace KinovaZED::Hw {
+
+/**
+ * Timing statistics of an actor's fixed-rate state update loop and joystick output
+ */
+struct UpdateStatistics {
+	/**
+	 * Record that an update tick fired late, possibly after having skipped whole periods
+	 */
+	auto recordTick(std::chrono::nanoseconds lateness, std::uint64_t skipped) noexcept -> void;
+
+	/**
+	 * Record how long a single state update took
+	 */
+	auto recordUpdate(std::chrono::nanoseconds duration) noexcept -> void;
+
+	/**
+	 * Record that a joystick update was received, and whether it replaced one that was not yet sent to the actor
+	 */
+	auto recordJoystickUpdate(bool coalesced) noexcept -> void;
+
+	auto averageLateness() const noexcept -> std::chrono::nanoseconds;
+
+	std::chrono::milliseconds period{};
+	std::uint64_t ticks{};
+	std::uint64_t skippedTicks{};
+	std::chrono::nanoseconds worstLateness{};
+	std::chrono::nanoseconds totalLateness{};
+	LatencyHistogram updateDurations{};
+	std::uint64_t joystickUpdates{};
+	std::uint64_t coalescedJoystickUpdates{};
+};
+
+} // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::UpdateStatistics const &statistics) -> std::string;
+
+} // namespace KinovaZED
+
+#endif
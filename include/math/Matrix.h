@@ -2,115 +2,370 @@
 #define KINOVA_MATH_MATRIX_H_
 
 #include "hw/Coordinates.h"
+#include "support/Expected.h"
+#include "support/Simd.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
-#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace KinovaZED {
 
-using f2d_vec_t = std::vector<std::vector<float>>;
+/**
+ * A row-major matrix with fixed dimensions
+ *
+ * Matrices and vectors are plain arrays, so they live on the stack, can be copied with a single memcpy and can be used
+ * in constant expressions.
+ *
+ * The scalar type defaults to float, which is what the arm reports and expects. double is meant for long chains of
+ * transformations, such as relative objectives built on top of each other, in which the rounding errors of float
+ * add up.
+ */
+template<std::size_t Rows, std::size_t Columns, typename ScalarType = float>
+using Matrix = std::array<std::array<ScalarType, Columns>, Rows>;
 
-constexpr float halfPi = 1.5708;
+template<std::size_t Size, typename ScalarType = float>
+using Vector = std::array<ScalarType, Size>;
+
+using Mat3 = Matrix<3, 3>;
+using Mat4 = Matrix<4, 4>;
+using Vec3 = Vector<3>;
+using Vec4 = Vector<4>;
+
+using Mat3d = Matrix<3, 3, double>;
+using Mat4d = Matrix<4, 4, double>;
+using Vec3d = Vector<3, double>;
+using Vec4d = Vector<4, double>;
+
+template<typename ScalarType>
+constexpr auto halfPi = static_cast<ScalarType>(1.57079632679489661923);
+
+namespace Detail {
+
+/**
+ * The yaw that getEulerAngles reports at the gimbal singularity
+ *
+ * Float keeps the rounded value that the arm path has always reported, so that its results are the same as before the
+ * math was templated.
+ */
+template<typename ScalarType>
+constexpr auto singularYaw = halfPi<ScalarType>;
+
+template<>
+constexpr auto singularYaw<float> = static_cast<float>(1.5708);
+
+/*Excludes a parameter from template argument deduction, so that it is converted to the deduced type instead.*/
+template<typename Type>
+struct NonDeduced {
+	using type = Type;
+};
+
+template<typename Type>
+using NonDeducedType = typename NonDeduced<Type>::type;
+
+template<std::size_t Rows, std::size_t Inner, std::size_t Columns, typename ScalarType, std::size_t... Indices>
+constexpr auto dot(Matrix<Rows, Inner, ScalarType> const &lhs,
+                   Matrix<Inner, Columns, ScalarType> const &rhs,
+                   std::size_t row,
+                   std::size_t column,
+                   std::index_sequence<Indices...>) -> ScalarType {
+	(void)row, (void)column;
+	return (ScalarType{} + ... + (lhs[row][Indices] * rhs[Indices][column]));
+}
+
+template<std::size_t Rows, std::size_t Columns, typename ScalarType, std::size_t... Indices>
+constexpr auto dot(Matrix<Rows, Columns, ScalarType> const &lhs,
+                   Vector<Columns, ScalarType> const &rhs,
+                   std::size_t row,
+                   std::index_sequence<Indices...>) -> ScalarType {
+	(void)row;
+	return (ScalarType{} + ... + (lhs[row][Indices] * rhs[Indices]));
+}
+
+} // namespace Detail
 
 /*Multiplies two matrices and returns resulting matrix.*/
-inline auto matMultiply(const f2d_vec_t &mat1, const f2d_vec_t &mat2) -> f2d_vec_t {
-	if (mat1.empty()) {
-		return {};
-	}
-	int d1 = mat1.size();
-	int d2 = mat1[0].size();
-	int d3 = mat2[0].size();
-
-	f2d_vec_t ans(d1, std::vector<float>(d3, 0));
-	for (int i = 0; i < d1; i++) {
-		for (int j = 0; j < d3; j++) {
-			for (int k = 0; k < d2; k++) {
-				ans[i][j] += mat1[i][k] * mat2[k][j];
-			}
+template<std::size_t Rows, std::size_t Inner, std::size_t Columns, typename ScalarType>
+constexpr auto matMultiply(Matrix<Rows, Inner, ScalarType> const &mat1, Matrix<Inner, Columns, ScalarType> const &mat2)
+    -> Matrix<Rows, Columns, ScalarType> {
+	auto ans = Matrix<Rows, Columns, ScalarType>{};
+	for (auto i = std::size_t{}; i < Rows; i++) {
+		for (auto j = std::size_t{}; j < Columns; j++) {
+			ans[i][j] = Detail::dot(mat1, mat2, i, j, std::make_index_sequence<Inner>{});
 		}
 	}
 	return ans;
 }
 
-/*takes Array of 3 Angles alpha, beta, gamma and returns RotationMatrix of Euler XYZ*/
-inline auto rotMatrix(float angle[3]) -> f2d_vec_t {
-	f2d_vec_t mat(3, std::vector<float>(3, 0));
-	double c[3], s[3];
+/*Multiplies a matrix with a column vector and returns the resulting vector.*/
+template<std::size_t Rows, std::size_t Columns, typename ScalarType>
+constexpr auto matMultiply(Matrix<Rows, Columns, ScalarType> const &mat, Vector<Columns, ScalarType> const &vec)
+    -> Vector<Rows, ScalarType> {
+	auto ans = Vector<Rows, ScalarType>{};
+	for (auto i = std::size_t{}; i < Rows; i++) {
+		ans[i] = Detail::dot(mat, vec, i, std::make_index_sequence<Columns>{});
+	}
+	return ans;
+}
+
+/*Extracts the rotational part of a homogeneous transformation matrix.*/
+template<typename ScalarType>
+constexpr auto rotationOf(Matrix<4, 4, ScalarType> const &transMat) -> Matrix<3, 3, ScalarType> {
+	return {{{transMat[0][0], transMat[0][1], transMat[0][2]},
+	         {transMat[1][0], transMat[1][1], transMat[1][2]},
+	         {transMat[2][0], transMat[2][1], transMat[2][2]}}};
+}
+
+/// @section Homogeneous transformation kernels
+
+/**
+ * Kernels on 4x4 homogeneous transformation matrices
+ *
+ * Every kernel exists as a scalar and a vectorized variant. The vectorized variants process one matrix row per
+ * Simd::Float4 and accumulate in the same order as the scalar ones, so both produce the same results unless the
+ * compiler contracts multiplications and additions. The unqualified names select the vectorized variants for float
+ * matrices on targets with SSE2 or NEON, and the scalar variants everywhere else. invertRigid is the exception: its
+ * scalar variant is mostly data movement and measures faster than the vectorized transpose, so it is always selected.
+ * Only the scalar variants support double matrices.
+ */
+namespace Kernels {
+
+namespace Scalar {
+
+/*Composes two transformations, so that the right hand side is applied first.*/
+template<typename ScalarType>
+constexpr auto compose(Matrix<4, 4, ScalarType> const &lhs, Matrix<4, 4, ScalarType> const &rhs)
+    -> Matrix<4, 4, ScalarType> {
+	return matMultiply(lhs, rhs);
+}
+
+/*Inverts a transformation consisting only of a rotation and a translation.*/
+template<typename ScalarType>
+constexpr auto invertRigid(Matrix<4, 4, ScalarType> const &matrix) -> Matrix<4, 4, ScalarType> {
+	return {{{matrix[0][0],
+	          matrix[1][0],
+	          matrix[2][0],
+	          -matrix[0][0] * matrix[0][3] - matrix[1][3] * matrix[1][0] - matrix[2][3] * matrix[2][0]},
+	         {matrix[0][1],
+	          matrix[1][1],
+	          matrix[2][1],
+	          -matrix[0][1] * matrix[0][3] - matrix[1][3] * matrix[1][1] - matrix[2][3] * matrix[2][1]},
+	         {matrix[0][2],
+	          matrix[1][2],
+	          matrix[2][2],
+	          -matrix[0][2] * matrix[0][3] - matrix[1][3] * matrix[1][2] - matrix[2][3] * matrix[2][2]},
+	         {0, 0, 0, 1}}};
+}
+
+/*Transforms a single point.*/
+template<typename ScalarType>
+constexpr auto transformPoint(Matrix<4, 4, ScalarType> const &matrix, Vector<3, ScalarType> const &point)
+    -> Vector<3, ScalarType> {
+	auto const transformed = matMultiply(matrix, Vector<4, ScalarType>{point[0], point[1], point[2], 1});
+	return {transformed[0], transformed[1], transformed[2]};
+}
+
+/*Transforms count points from input into output.*/
+template<typename ScalarType>
+inline auto transformPoints(Matrix<4, 4, ScalarType> const &matrix,
+                            ::KinovaZED::Detail::NonDeducedType<Vector<3, ScalarType>> const *input,
+                            ::KinovaZED::Detail::NonDeducedType<Vector<3, ScalarType>> *output,
+                            std::size_t count) -> void {
+	for (auto index = std::size_t{}; index < count; ++index) {
+		output[index] = transformPoint(matrix, input[index]);
+	}
+}
+
+} // namespace Scalar
+
+namespace Vectorized {
+
+namespace Detail {
+
+struct Rows {
+	Simd::Float4 first, second, third, fourth;
+};
+
+inline auto load(Mat4 const &matrix) noexcept -> Rows {
+	return {Simd::load(matrix[0].data()),
+	        Simd::load(matrix[1].data()),
+	        Simd::load(matrix[2].data()),
+	        Simd::load(matrix[3].data())};
+}
+
+inline auto columns(Mat4 const &matrix) noexcept -> Rows {
+	auto rows = load(matrix);
+	Simd::transpose(rows.first, rows.second, rows.third, rows.fourth);
+	return rows;
+}
+
+inline auto combine(Rows const &rows, float first, float second, float third, float fourth) noexcept -> Simd::Float4 {
+	auto const firstTwo =
+	    Simd::add(Simd::mul(Simd::splat(first), rows.first), Simd::mul(Simd::splat(second), rows.second));
+	auto const firstThree = Simd::add(firstTwo, Simd::mul(Simd::splat(third), rows.third));
+	return Simd::add(firstThree, Simd::mul(Simd::splat(fourth), rows.fourth));
+}
+
+inline auto transformPoint(Rows const &columns, Vec3 const &point) noexcept -> Vec3 {
+	auto transformed = Vec4{};
+	Simd::store(transformed.data(), combine(columns, point[0], point[1], point[2], 1));
+	return {transformed[0], transformed[1], transformed[2]};
+}
+
+} // namespace Detail
+
+/*Composes two transformations, so that the right hand side is applied first.*/
+inline auto compose(Mat4 const &lhs, Mat4 const &rhs) -> Mat4 {
+	auto const rows = Detail::load(rhs);
+	auto result = Mat4{};
+	for (auto row = std::size_t{}; row < 4; ++row) {
+		auto const &factors = lhs[row];
+		Simd::store(result[row].data(), Detail::combine(rows, factors[0], factors[1], factors[2], factors[3]));
+	}
+	return result;
+}
+
+/*Inverts a transformation consisting only of a rotation and a translation.*/
+inline auto invertRigid(Mat4 const &matrix) -> Mat4 {
+	auto rows = Detail::load(matrix);
+
+	// The translation of the inverse is the negated translation, rotated by the transposed rotation
+	auto const rotated = Simd::add(Simd::add(Simd::mul(Simd::splat(matrix[0][3]), rows.first),
+	                                         Simd::mul(Simd::splat(matrix[1][3]), rows.second)),
+	                               Simd::mul(Simd::splat(matrix[2][3]), rows.third));
+	rows.fourth = Simd::sub(Simd::splat(0), rotated);
+
+	Simd::transpose(rows.first, rows.second, rows.third, rows.fourth);
+	auto result = Mat4{};
+	Simd::store(result[0].data(), rows.first);
+	Simd::store(result[1].data(), rows.second);
+	Simd::store(result[2].data(), rows.third);
+	result[3] = {0, 0, 0, 1};
+	return result;
+}
+
+/*Transforms a single point.*/
+inline auto transformPoint(Mat4 const &matrix, Vec3 const &point) -> Vec3 {
+	return Detail::transformPoint(Detail::columns(matrix), point);
+}
+
+/*Transforms count points from input into output, transposing the matrix only once.*/
+inline auto transformPoints(Mat4 const &matrix, Vec3 const *input, Vec3 *output, std::size_t count) -> void {
+	auto const columns = Detail::columns(matrix);
+	for (auto index = std::size_t{}; index < count; ++index) {
+		output[index] = Detail::transformPoint(columns, input[index]);
+	}
+}
+
+} // namespace Vectorized
+
+#if defined(KINOVAZED_SIMD_SSE2) || defined(KINOVAZED_SIMD_NEON)
+// The vectorized variants are no templates, so overload resolution prefers them for float matrices
+auto constexpr isVectorized = true;
+using Scalar::compose;
+using Scalar::invertRigid;
+using Scalar::transformPoint;
+using Scalar::transformPoints;
+using Vectorized::compose;
+using Vectorized::transformPoint;
+using Vectorized::transformPoints;
+#else
+auto constexpr isVectorized = false;
+using Scalar::compose;
+using Scalar::invertRigid;
+using Scalar::transformPoint;
+using Scalar::transformPoints;
+#endif
+
+} // namespace Kernels
+
+/// @section Euler angles
+
+/**
+ * Takes Array of 3 Angles alpha, beta, gamma and returns RotationMatrix of Euler XYZ
+ *
+ * The products are accumulated in at least double precision and only rounded to the scalar type at the end, so the
+ * float results stay the same as before the math was templated.
+ */
+template<typename ScalarType>
+inline auto rotMatrix(ScalarType const angle[3]) -> Matrix<3, 3, ScalarType> {
+	using Precise = std::common_type_t<ScalarType, double>;
+
+	Precise c[3], s[3];
 	for (int i = 0; i < 3; i++) {
 		c[i] = std::cos(angle[i]);
 		s[i] = std::sin(angle[i]);
 	}
 	// Hardcoded RotationMatrix of Euler XYZ
-	mat[0][0] = c[1] * c[2];
-	mat[0][1] = -c[1] * s[2];
-	mat[0][2] = s[1];
-	mat[1][0] = c[0] * s[2] + s[0] * c[2] * s[1];
-	mat[1][1] = c[0] * c[2] - s[0] * s[2] * s[1];
-	mat[1][2] = -s[0] * c[1];
-	mat[2][0] = s[0] * s[2] - c[0] * c[2] * s[1];
-	mat[2][1] = s[0] * c[2] + c[0] * s[2] * s[1];
-	mat[2][2] = c[0] * c[1];
-	return mat;
+	return {{{static_cast<ScalarType>(c[1] * c[2]),
+	          static_cast<ScalarType>(-c[1] * s[2]),
+	          static_cast<ScalarType>(s[1])},
+	         {static_cast<ScalarType>(c[0] * s[2] + s[0] * c[2] * s[1]),
+	          static_cast<ScalarType>(c[0] * c[2] - s[0] * s[2] * s[1]),
+	          static_cast<ScalarType>(-s[0] * c[1])},
+	         {static_cast<ScalarType>(s[0] * s[2] - c[0] * c[2] * s[1]),
+	          static_cast<ScalarType>(s[0] * c[2] + c[0] * s[2] * s[1]),
+	          static_cast<ScalarType>(c[0] * c[1])}}};
 }
 
 /*returns Euler Angles of Euler XYZ rotational matrix.*/
-inline auto getEulerAngles(const f2d_vec_t rotMat) -> std::vector<float> {
-	std::vector<float> res(3);
+template<typename ScalarType>
+inline auto getEulerAngles(Matrix<3, 3, ScalarType> const &rotMat) -> Vector<3, ScalarType> {
 	if (rotMat[0][2] < 1) {
 		if (rotMat[0][2] > -1) {
-			res[0] = std::atan2(-rotMat[1][2], rotMat[2][2]);
-			res[1] = std::asin(rotMat[0][2]);
-			res[2] = std::atan2(-rotMat[0][1], rotMat[0][0]);
+			return {std::atan2(-rotMat[1][2], rotMat[2][2]),
+			        std::asin(rotMat[0][2]),
+			        std::atan2(-rotMat[0][1], rotMat[0][0])};
 		} else { // <= -1
-			res[0] = -std::atan2(rotMat[1][0], rotMat[1][1]);
-			res[1] = -halfPi;
-			res[2] = 0;
+			return {-std::atan2(rotMat[1][0], rotMat[1][1]), -Detail::singularYaw<ScalarType>, 0};
 		}
 	} else { //>= 1
-		res[0] = std::atan2(rotMat[1][0], rotMat[1][1]);
-		res[1] = halfPi;
-		res[2] = 0;
+		return {std::atan2(rotMat[1][0], rotMat[1][1]), Detail::singularYaw<ScalarType>, 0};
 	}
-	return res;
 }
 
-/*Transforms coordinates Objective coordinate system to Basis coordinate system*/
-inline auto coordTransform(float *coordinates, const f2d_vec_t &transMat) -> KinovaZED::Hw::Coordinates {
-	// define point Vector ([x;y;z;1]) and angle Vector ([alpha, beta, gamma])
-	f2d_vec_t cord(4, std::vector<float>(1, 0));
-	float ang[3];
-	for (int i = 0; i < 3; i++) {
-		cord[i][0] = coordinates[i];
-		ang[i] = coordinates[i + 3];
-	}
-	cord[3][0] = 1;
-	// Multiply Point Vector with TransformationMatrix
-	cord = matMultiply(transMat, cord);
+/**
+ * Transform coordinates from the Objective coordinate system to the Basis coordinate system
+ *
+ * A result outside of the reachable box is reported as an error instead of throwing.
+ */
+template<typename ScalarType>
+inline auto coordTransform(ScalarType *coordinates, Matrix<4, 4, ScalarType> const &transMat)
+    -> Expected<KinovaZED::Hw::Coordinates, KinovaZED::Hw::CoordinateError> {
+	// Build the transformation of the point from its position and the rotational Matrix of its angles
+	auto const rotation = rotMatrix(coordinates + 3);
+	auto const point = Matrix<4, 4, ScalarType>{{{rotation[0][0], rotation[0][1], rotation[0][2], coordinates[0]},
+	                                             {rotation[1][0], rotation[1][1], rotation[1][2], coordinates[1]},
+	                                             {rotation[2][0], rotation[2][1], rotation[2][2], coordinates[2]},
+	                                             {0, 0, 0, 1}}};
+
+	// Combine it with the transformation of the Objective in the Base Coordinate System
+	auto const combined = Kernels::compose(transMat, point);
+	auto const angles = getEulerAngles(rotationOf(combined));
 
-	// Get rotational Matrix from Objective in Base Coordinate System. (extracted from inverse transformation Matrix
-	f2d_vec_t R1(3, std::vector<float>(3, 0));
-	for (int i = 0; i < 3; i++) {
-		for (int j = 0; j < 3; j++) {
-			R1[i][j] = transMat[i][j];
-		}
-	}
-	// Get rotational Matrix from Point angles in Objective coordinate system.
-	f2d_vec_t R2 = rotMatrix(ang);
-	// Calculate rotational Matrix from Point in Objective Coordinate System
-	f2d_vec_t R3 = matMultiply(R1, R2);
-	std::vector<float> angles = getEulerAngles(R3);
 	// write coordinates
 	for (int i = 0; i < 3; i++) {
-		coordinates[i] = cord[i][0];
+		coordinates[i] = combined[i][3];
 		coordinates[i + 3] = angles[i];
 	}
-	return {coordinates[0], coordinates[1], coordinates[2], coordinates[3], coordinates[4], coordinates[5]};
+	return KinovaZED::Hw::Coordinates::make(static_cast<float>(coordinates[0]),
+	                                        static_cast<float>(coordinates[1]),
+	                                        static_cast<float>(coordinates[2]),
+	                                        static_cast<float>(coordinates[3]),
+	                                        static_cast<float>(coordinates[4]),
+	                                        static_cast<float>(coordinates[5]));
 }
 
-inline auto coordTransform(KinovaZED::Hw::Coordinates const &coordinates, f2d_vec_t const &transformationMatrix)
-    -> KinovaZED::Hw::Coordinates {
-	std::array<float, 6> data = coordinates;
+template<typename ScalarType>
+inline auto coordTransform(KinovaZED::Hw::Coordinates const &coordinates,
+                           Matrix<4, 4, ScalarType> const &transformationMatrix)
+    -> Expected<KinovaZED::Hw::Coordinates, KinovaZED::Hw::CoordinateError> {
+	std::array<float, 6> const values = coordinates;
+	auto data = std::array<ScalarType, 6>{};
+	std::copy(cbegin(values), cend(values), begin(data));
 	return coordTransform(data.data(), transformationMatrix);
 }
 
@@ -0,0 +1,223 @@
+#ifndef INCLUDE_MATH_POSE_H_
+#define INCLUDE_MATH_POSE_H_
+
+#include "hw/Coordinates.h"
+#include "math/Matrix.h"
+#include "support/Expected.h"
+
+#include <cmath>
+
+namespace KinovaZED {
+
+/**
+ * A rotation represented as a unit quaternion
+ *
+ * Rotations are composed and applied without any trigonometric functions. Only the conversions from and to the Euler
+ * angles used by the Kinova arm need them.
+ */
+template<typename ScalarType>
+struct BasicQuaternion {
+	using Vector3 = Vector<3, ScalarType>;
+
+	ScalarType w{1};
+	ScalarType x{};
+	ScalarType y{};
+	ScalarType z{};
+
+	/**
+	 * Create the rotation described by the given Euler XYZ angles, using the same convention as rotMatrix
+	 */
+	static auto fromEulerXYZ(Vector3 const &angles) -> BasicQuaternion;
+
+	/**
+	 * Convert the rotation into Euler XYZ angles, using the same convention as getEulerAngles
+	 *
+	 * Unlike getEulerAngles, the conversion stays accurate close to the gimbal singularity at a yaw of ±pi/2, and
+	 * yields exactly ±pi/2 at the singularity itself.
+	 */
+	auto toEulerXYZ() const -> Vector3;
+
+	constexpr auto conjugate() const -> BasicQuaternion {
+		return {w, -x, -y, -z};
+	}
+
+	constexpr auto norm2() const -> ScalarType {
+		return w * w + x * x + y * y + z * z;
+	}
+
+	/**
+	 * Rotate the given vector
+	 */
+	constexpr auto rotate(Vector3 const &vector) const -> Vector3 {
+		auto const tx = 2 * (y * vector[2] - z * vector[1]);
+		auto const ty = 2 * (z * vector[0] - x * vector[2]);
+		auto const tz = 2 * (x * vector[1] - y * vector[0]);
+		return {vector[0] + w * tx + (y * tz - z * ty),
+		        vector[1] + w * ty + (z * tx - x * tz),
+		        vector[2] + w * tz + (x * ty - y * tx)};
+	}
+
+	/**
+	 * Get the rotation matrix of this rotation
+	 */
+	constexpr auto toMatrix() const -> Matrix<3, 3, ScalarType> {
+		auto const s = 2 / norm2();
+		return {{{1 - s * (y * y + z * z), s * (x * y - w * z), s * (x * z + w * y)},
+		         {s * (x * y + w * z), 1 - s * (x * x + z * z), s * (y * z - w * x)},
+		         {s * (x * z - w * y), s * (y * z + w * x), 1 - s * (x * x + y * y)}}};
+	}
+};
+
+using Quaternion = BasicQuaternion<float>;
+
+/**
+ * Compose two rotations, so that the right hand side is applied first
+ */
+template<typename ScalarType>
+constexpr auto operator*(BasicQuaternion<ScalarType> const &lhs, BasicQuaternion<ScalarType> const &rhs)
+    -> BasicQuaternion<ScalarType> {
+	return {lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
+	        lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+	        lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+	        lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w};
+}
+
+/**
+ * A rigid transformation, consisting of a rotation followed by a translation
+ *
+ * A pose describes both the position and orientation of a point, and the frame of an objective relative to the base of
+ * the arm. Composing poses is equivalent to multiplying the corresponding homogeneous transformation matrices.
+ *
+ * The arm-facing path uses float poses. Poses with a scalar type of double keep the rounding errors small across long
+ * chains of compositions, and only round to float when they are converted back into coordinates.
+ */
+template<typename ScalarType>
+struct BasicPose {
+	using Vector3 = Vector<3, ScalarType>;
+
+	BasicQuaternion<ScalarType> rotation{};
+	Vector3 translation{};
+
+	/**
+	 * Create the pose described by the given coordinates
+	 */
+	static auto fromCoordinates(Hw::Coordinates const &coordinates) -> BasicPose;
+
+	/**
+	 * Convert the pose into coordinates of the arm, reporting a position outside of the reachable box as an error
+	 */
+	auto toCoordinates() const -> Expected<Hw::Coordinates, Hw::CoordinateError>;
+
+	constexpr auto inverse() const -> BasicPose {
+		auto const inverted = rotation.conjugate();
+		auto const position = inverted.rotate(translation);
+		return {inverted, {-position[0], -position[1], -position[2]}};
+	}
+
+	/**
+	 * Transform the given point into the parent frame of this pose
+	 */
+	constexpr auto apply(Vector3 const &point) const -> Vector3 {
+		auto const rotated = rotation.rotate(point);
+		return {rotated[0] + translation[0], rotated[1] + translation[1], rotated[2] + translation[2]};
+	}
+
+	/**
+	 * Get the homogeneous transformation matrix of this pose
+	 */
+	constexpr auto toMatrix() const -> Matrix<4, 4, ScalarType> {
+		auto const r = rotation.toMatrix();
+		return {{{r[0][0], r[0][1], r[0][2], translation[0]},
+		         {r[1][0], r[1][1], r[1][2], translation[1]},
+		         {r[2][0], r[2][1], r[2][2], translation[2]},
+		         {0, 0, 0, 1}}};
+	}
+};
+
+using Pose = BasicPose<float>;
+
+/**
+ * Compose two poses, so that the right hand side is expressed in the frame of the left hand side
+ */
+template<typename ScalarType>
+constexpr auto operator*(BasicPose<ScalarType> const &lhs, BasicPose<ScalarType> const &rhs) -> BasicPose<ScalarType> {
+	return {lhs.rotation * rhs.rotation, lhs.apply(rhs.translation)};
+}
+
+template<typename ScalarType>
+inline auto BasicQuaternion<ScalarType>::fromEulerXYZ(Vector3 const &angles) -> BasicQuaternion {
+	auto const cx = std::cos(angles[0] / 2), sx = std::sin(angles[0] / 2);
+	auto const cy = std::cos(angles[1] / 2), sy = std::sin(angles[1] / 2);
+	auto const cz = std::cos(angles[2] / 2), sz = std::sin(angles[2] / 2);
+	return BasicQuaternion{cx, sx, 0, 0} * BasicQuaternion{cy, 0, sy, 0} * BasicQuaternion{cz, 0, 0, sz};
+}
+
+namespace Detail {
+
+/**
+ * Wrap an angle that is at most one full turn outside of [-pi, pi] back into that range
+ */
+template<typename ScalarType>
+inline auto wrapAngle(ScalarType angle) -> ScalarType {
+	auto constexpr pi = 2 * halfPi<ScalarType>;
+	if (angle > pi) {
+		return angle - 2 * pi;
+	}
+	if (angle < -pi) {
+		return angle + 2 * pi;
+	}
+	return angle;
+}
+
+} // namespace Detail
+
+template<typename ScalarType>
+inline auto BasicQuaternion<ScalarType>::toEulerXYZ() const -> Vector3 {
+	auto constexpr exactPi = 2 * halfPi<ScalarType>;
+	auto constexpr exactHalfPi = halfPi<ScalarType>;
+	auto constexpr singularityTolerance = static_cast<ScalarType>(1e-6);
+
+	// Read the angles directly from the quaternion, with the rotation treated as an extrinsic ZYX sequence. Unlike
+	// going through the rotation matrix, this does not suffer from cancellation close to the singularity.
+	auto const a = w - y;
+	auto const b = z - x;
+	auto const c = w + y;
+	auto const d = -x - z;
+	auto const middle = 2 * std::atan2(std::sqrt(c * c + d * d), std::sqrt(a * a + b * b));
+	auto const sum = std::atan2(b, a);
+	auto const difference = std::atan2(d, c);
+
+	// At the singularity, pitch and roll rotate around the same axis and only their combination is defined
+	auto first = sum - difference;
+	auto third = sum + difference;
+	if (middle < singularityTolerance) {
+		first = 0;
+		third = 2 * sum;
+	} else if (middle > exactPi - singularityTolerance) {
+		first = 0;
+		third = 2 * difference;
+	}
+
+	return {Detail::wrapAngle(-third), middle - exactHalfPi, Detail::wrapAngle(first)};
+}
+
+template<typename ScalarType>
+inline auto BasicPose<ScalarType>::fromCoordinates(Hw::Coordinates const &coordinates) -> BasicPose {
+	auto const angles = Vector3{coordinates.pitch, coordinates.yaw, coordinates.roll};
+	return {BasicQuaternion<ScalarType>::fromEulerXYZ(angles), {coordinates.x, coordinates.y, coordinates.z}};
+}
+
+template<typename ScalarType>
+inline auto BasicPose<ScalarType>::toCoordinates() const -> Expected<Hw::Coordinates, Hw::CoordinateError> {
+	auto const angles = rotation.toEulerXYZ();
+	return Hw::Coordinates::make(static_cast<float>(translation[0]),
+	                             static_cast<float>(translation[1]),
+	                             static_cast<float>(translation[2]),
+	                             static_cast<float>(angles[0]),
+	                             static_cast<float>(angles[1]),
+	                             static_cast<float>(angles[2]));
+}
+
+} // namespace KinovaZED
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef INCLUDE_SUPPORT_CPU_TIME_H_
+#define INCLUDE_SUPPORT_CPU_TIME_H_
+
+#include <time.h>
+
+#include <chrono>
+
+namespace KinovaZED {
+
+/**
+ * Get the CPU time consumed by the calling thread so far
+ */
+auto inline threadCpuTime() -> std::chrono::nanoseconds {
+	auto now = timespec{};
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	return std::chrono::seconds{now.tv_sec} + std::chrono::nanoseconds{now.tv_nsec};
+}
+
+} // namespace KinovaZED
+
+#endif
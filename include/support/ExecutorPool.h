@@ -0,0 +1,52 @@
+#ifndef INCLUDE_SUPPORT_EXECUTOR_POOL_H_
+#define INCLUDE_SUPPORT_EXECUTOR_POOL_H_
+
+#include <asio/executor_work_guard.hpp>
+#include <asio/io_context.hpp>
+#include <asio/io_context_strand.hpp>
+
+#include <cstddef>
+#include <future>
+#include <vector>
+
+namespace KinovaZED {
+
+/**
+ * A fixed number of threads running the handlers of a shared execution context
+ *
+ * Every actor that runs on the pool serializes its handlers on its own strand, so any number of actors can share the
+ * same threads. The pool keeps running until it is shut down, even if there is no work.
+ */
+struct ExecutorPool {
+	explicit ExecutorPool(std::size_t threads);
+	~ExecutorPool();
+
+	ExecutorPool(ExecutorPool const &) = delete;
+	ExecutorPool &operator=(ExecutorPool const &) = delete;
+
+	auto context() noexcept -> asio::io_context &;
+	auto size() const noexcept -> std::size_t;
+
+	/**
+	 * Stop running handlers and wait for all threads to finish
+	 *
+	 * @note Handlers that are still pending are dropped, so all actors on the pool should be disconnected first
+	 */
+	auto shutdown() -> void;
+
+  private:
+	asio::io_context ioContext{};
+	asio::executor_work_guard<asio::io_context::executor_type> workGuard;
+	std::vector<std::future<void>> runners{};
+};
+
+/**
+ * Block until all handlers that were queued on the given strand before the call have finished
+ *
+ * @note Must not be called from a handler running on the given strand
+ */
+auto drain(asio::io_context::strand &strand) -> void;
+
+} // namespace KinovaZED
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef INCLUDE_SUPPORT_EXPECTED_H_
+#define INCLUDE_SUPPORT_EXPECTED_H_
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace KinovaZED {
+
+/**
+ * A wrapper to explicitly construct an Expected holding an error
+ */
+template<typename ErrorType>
+struct Unexpected {
+	ErrorType error;
+};
+
+template<typename ErrorType>
+Unexpected(ErrorType) -> Unexpected<ErrorType>;
+
+/**
+ * Thrown when the value of an Expected holding an error is accessed
+ */
+struct BadExpectedAccess : std::logic_error {
+	BadExpectedAccess()
+	    : std::logic_error{"tried to access the value of an Expected holding an error"} {
+	}
+};
+
+/**
+ * Either a value or the error that prevented it from being produced
+ *
+ * This is a small subset of C++23's std::expected, for code paths that regularly encounter invalid input and
+ * therefore should not use exceptions to report it.
+ */
+template<typename ValueType, typename ErrorType>
+struct Expected {
+	static_assert(!std::is_same_v<ValueType, ErrorType>, "Value and error types of an Expected must be distinct!");
+
+	Expected(ValueType value)
+	    : content{std::in_place_index<0>, std::move(value)} {
+	}
+
+	Expected(Unexpected<ErrorType> unexpected)
+	    : content{std::in_place_index<1>, std::move(unexpected.error)} {
+	}
+
+	auto hasValue() const noexcept -> bool {
+		return content.index() == 0;
+	}
+
+	explicit operator bool() const noexcept {
+		return hasValue();
+	}
+
+	/**
+	 * Get the contained value
+	 *
+	 * @throws BadExpectedAccess if there is no value
+	 */
+	auto value() const & -> ValueType const & {
+		if (!hasValue()) {
+			throw BadExpectedAccess{};
+		}
+		return *std::get_if<0>(&content);
+	}
+
+	auto value() && -> ValueType {
+		if (!hasValue()) {
+			throw BadExpectedAccess{};
+		}
+		return std::move(*std::get_if<0>(&content));
+	}
+
+	auto valueOr(ValueType fallback) const -> ValueType {
+		return hasValue() ? *std::get_if<0>(&content) : fallback;
+	}
+
+	/**
+	 * Get the contained error
+	 *
+	 * @note Must only be called if there is no value
+	 */
+	auto error() const noexcept -> ErrorType const & {
+		return *std::get_if<1>(&content);
+	}
+
+	/**
+	 * Access the contained value without checking
+	 *
+	 * @note Must only be called if there is a value
+	 */
+	auto operator*() const noexcept -> ValueType const & {
+		return *std::get_if<0>(&content);
+	}
+
+	auto operator->() const noexcept -> ValueType const * {
+		return std::get_if<0>(&content);
+	}
+
+  private:
+	std::variant<ValueType, ErrorType> content;
+};
+
+} // namespace KinovaZED
+
+#endif
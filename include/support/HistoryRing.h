@@ -0,0 +1,111 @@
+#ifndef INCLUDE_SUPPORT_HISTORY_RING_H_
+#define INCLUDE_SUPPORT_HISTORY_RING_H_
+
+#include "support/SeqLock.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace KinovaZED {
+
+/**
+ * A fixed-capacity history of timestamped samples with a single writer and lock-free readers
+ *
+ * The writer overwrites the oldest sample once the ring is full, and never waits for readers. Every slot is protected
+ * by its own sequence lock, so readers always observe complete samples. A reader that gets lapped by the writer
+ * simply loses the overwritten samples instead of observing newer ones in their place.
+ *
+ * The sample type must be trivially copyable and provide a `timestamp` member.
+ */
+template<typename SampleType, std::size_t Capacity>
+struct HistoryRing {
+	static_assert(Capacity > 0, "A HistoryRing must be able to hold at least one sample!");
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 * Append a new sample, replacing the oldest one if the ring is full
+	 *
+	 * @note Only a single thread must ever push into a given HistoryRing
+	 */
+	auto push(SampleType const &sample) noexcept -> void {
+		auto const index = written.load(std::memory_order_relaxed);
+		slots[index % Capacity].store(sample);
+		written.store(index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * Copy up to the given number of the most recent samples, oldest first
+	 *
+	 * @return The output iterator past the last copied sample
+	 */
+	template<typename OutputIterator>
+	auto last(std::size_t count, OutputIterator out) const -> OutputIterator {
+		auto const end = written.load(std::memory_order_acquire);
+		auto const available = std::min<std::uint64_t>({count, end, Capacity});
+		return copy(end - available, end, out);
+	}
+
+	/**
+	 * Copy all retained samples with a timestamp not older than the given point in time, oldest first
+	 *
+	 * @return The output iterator past the last copied sample
+	 */
+	template<typename OutputIterator>
+	auto since(Clock::time_point earliest, OutputIterator out) const -> OutputIterator {
+		auto const end = written.load(std::memory_order_acquire);
+		auto begin = end - std::min<std::uint64_t>(end, Capacity);
+
+		auto sample = SampleType{};
+		while (begin < end && (!read(begin, sample) || sample.timestamp < earliest)) {
+			++begin;
+		}
+
+		return copy(begin, end, out);
+	}
+
+	/**
+	 * Get the total number of samples that were ever pushed
+	 */
+	auto size() const noexcept -> std::uint64_t {
+		return written.load(std::memory_order_acquire);
+	}
+
+	auto constexpr static capacity() noexcept -> std::size_t {
+		return Capacity;
+	}
+
+  private:
+	template<typename OutputIterator>
+	auto copy(std::uint64_t begin, std::uint64_t end, OutputIterator out) const -> OutputIterator {
+		auto sample = SampleType{};
+		for (auto index = begin; index < end; ++index) {
+			if (read(index, sample)) {
+				*out++ = sample;
+			}
+		}
+		return out;
+	}
+
+	/**
+	 * Read the sample with the given sequence number, unless it has already been overwritten
+	 */
+	auto read(std::uint64_t index, SampleType &sample) const noexcept -> bool {
+		auto version = std::uint64_t{};
+		sample = slots[index % Capacity].load(&version);
+
+		// Version 1 is the slot's initial value, the n-th push into the slot produces version n + 1.
+		return version == index / Capacity + 2;
+	}
+
+	std::array<SeqLock<SampleType>, Capacity> slots{};
+	std::atomic<std::uint64_t> written{};
+};
+
+} // namespace KinovaZED
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef INCLUDE_SUPPORT_LATENCY_HISTOGRAM_H_
+#define INCLUDE_SUPPORT_LATENCY_HISTOGRAM_H_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace KinovaZED {
+
+/**
+ * A fixed-size histogram of durations with power-of-two microsecond buckets
+ *
+ * Bucket 0 counts all samples below 1us, bucket n counts the samples in [2^(n-1)us, 2^n us), and the last bucket
+ * collects everything that does not fit into the other ones. Recording a sample never allocates.
+ */
+struct LatencyHistogram {
+	auto constexpr static bucketCount = std::size_t{16};
+
+	auto record(std::chrono::nanoseconds sample) noexcept -> void {
+		auto const micros = static_cast<std::uint64_t>(
+		    std::max(std::chrono::duration_cast<std::chrono::microseconds>(sample).count(), std::int64_t{}));
+
+		auto index = std::size_t{};
+		while (index < bucketCount - 1 && (std::uint64_t{1} << index) <= micros) {
+			++index;
+		}
+
+		++buckets[index];
+		++samples;
+		total += sample;
+		maximum = std::max(maximum, sample);
+	}
+
+	/**
+	 * Get the number of recorded samples
+	 */
+	auto count() const noexcept -> std::uint64_t {
+		return samples;
+	}
+
+	/**
+	 * Get the number of samples in the given bucket
+	 */
+	auto bucket(std::size_t index) const noexcept -> std::uint64_t {
+		return buckets[index];
+	}
+
+	/**
+	 * Get the exclusive upper bound of the given bucket
+	 *
+	 * The last bucket is unbounded and reports the largest sample instead.
+	 */
+	auto upperBound(std::size_t index) const noexcept -> std::chrono::nanoseconds {
+		if (index == bucketCount - 1) {
+			return maximum;
+		}
+		return std::chrono::microseconds{std::uint64_t{1} << index};
+	}
+
+	/**
+	 * Get an upper bound for the given fraction (0.0 to 1.0) of all samples
+	 */
+	auto percentile(double fraction) const noexcept -> std::chrono::nanoseconds {
+		auto const threshold = fraction * static_cast<double>(samples);
+		auto accumulated = std::uint64_t{};
+
+		for (auto index = std::size_t{}; index < bucketCount; ++index) {
+			accumulated += buckets[index];
+			if (accumulated && static_cast<double>(accumulated) >= threshold) {
+				return std::min(upperBound(index), maximum);
+			}
+		}
+
+		return maximum;
+	}
+
+	auto mean() const noexcept -> std::chrono::nanoseconds {
+		return samples ? total / static_cast<std::int64_t>(samples) : std::chrono::nanoseconds{};
+	}
+
+	auto max() const noexcept -> std::chrono::nanoseconds {
+		return maximum;
+	}
+
+  private:
+	std::array<std::uint64_t, bucketCount> buckets{};
+	std::uint64_t samples{};
+	std::chrono::nanoseconds total{};
+	std::chrono::nanoseconds maximum{};
+};
+
+} // namespace KinovaZED
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef INCLUDE_SUPPORT_SEQ_LOCK_H_
+#define INCLUDE_SUPPORT_SEQ_LOCK_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace KinovaZED {
+
+/**
+ * A single-writer/multi-reader sequence lock
+ *
+ * The writer never waits for readers, and readers never wait for each other. A reader that overlaps with a write
+ * simply retries. The payload is stored in atomic words, so that a torn read is well-defined and gets discarded.
+ */
+template<typename ValueType>
+struct SeqLock {
+	SeqLock()
+	    : SeqLock{ValueType{}} {
+	}
+
+	explicit SeqLock(ValueType const &initial) {
+		static_assert(std::is_trivially_copyable_v<ValueType>, "SeqLock payloads must be trivially copyable!");
+		static_assert(std::is_default_constructible_v<ValueType>, "SeqLock payloads must be default constructible!");
+		store(initial);
+	}
+
+	SeqLock(SeqLock const &) = delete;
+	auto operator=(SeqLock const &) -> SeqLock & = delete;
+
+	/**
+	 * Publish a new value
+	 *
+	 * @note Only a single thread must ever store into a given SeqLock
+	 */
+	auto store(ValueType const &value) noexcept -> void {
+		auto buffer = Words{};
+		std::memcpy(buffer.data(), &value, sizeof(ValueType));
+
+		auto sequence = sequenceNumber.load(std::memory_order_relaxed);
+		sequenceNumber.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		for (auto index = 0u; index < wordCount; ++index) {
+			words[index].store(buffer[index], std::memory_order_relaxed);
+		}
+
+		sequenceNumber.store(sequence + 2, std::memory_order_release);
+	}
+
+	/**
+	 * Get a consistent copy of the last published value
+	 */
+	auto load() const noexcept -> ValueType {
+		return load(nullptr);
+	}
+
+	/**
+	 * Get a consistent copy of the last published value together with its version
+	 *
+	 * The version starts at 1 for the initial value, and increases by one with every store.
+	 */
+	auto load(std::uint64_t *version) const noexcept -> ValueType {
+		auto buffer = Words{};
+		auto before = std::uint64_t{};
+
+		do {
+			before = sequenceNumber.load(std::memory_order_acquire);
+			for (auto index = 0u; index < wordCount; ++index) {
+				buffer[index] = words[index].load(std::memory_order_relaxed);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+		} while ((before & 1) || before != sequenceNumber.load(std::memory_order_relaxed));
+
+		if (version) {
+			*version = before / 2;
+		}
+
+		auto value = ValueType{};
+		std::memcpy(static_cast<void *>(&value), buffer.data(), sizeof(ValueType));
+		return value;
+	}
+
+	/**
+	 * Get the version of the last published value
+	 */
+	auto version() const noexcept -> std::uint64_t {
+		return sequenceNumber.load(std::memory_order_acquire) / 2;
+	}
+
+  private:
+	using Word = std::uint64_t;
+
+	static_assert(std::atomic<Word>::is_always_lock_free, "A SeqLock requires lock-free atomic words!");
+
+	auto constexpr static wordCount = (sizeof(ValueType) + sizeof(Word) - 1) / sizeof(Word);
+
+	using Words = std::array<Word, wordCount>;
+
+	std::atomic<std::uint64_t> sequenceNumber{};
+	std::array<std::atomic<Word>, wordCount> words{};
+};
+
+} // namespace KinovaZED
+
+#endif
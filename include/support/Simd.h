@@ -0,0 +1,209 @@
+#ifndef INCLUDE_SUPPORT_SIMD_H_
+#define INCLUDE_SUPPORT_SIMD_H_
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define KINOVAZED_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define KINOVAZED_SIMD_NEON 1
+#endif
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace KinovaZED::Simd {
+
+/**
+ * A minimal set of operations on four packed floats
+ *
+ * The operations map to SSE2 on x86, to NEON on ARM, and to plain loops everywhere else. Only what the coordinate and
+ * matrix computations actually need is provided.
+ */
+#if defined(KINOVAZED_SIMD_SSE2)
+
+using Float4 = __m128;
+using Mask4 = __m128;
+
+inline auto load(float const *data) noexcept -> Float4 {
+	return _mm_loadu_ps(data);
+}
+
+inline auto store(float *data, Float4 value) noexcept -> void {
+	_mm_storeu_ps(data, value);
+}
+
+inline auto set(float a, float b, float c, float d) noexcept -> Float4 {
+	return _mm_setr_ps(a, b, c, d);
+}
+
+inline auto splat(float value) noexcept -> Float4 {
+	return _mm_set1_ps(value);
+}
+
+inline auto add(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return _mm_add_ps(lhs, rhs);
+}
+
+inline auto sub(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return _mm_sub_ps(lhs, rhs);
+}
+
+inline auto mul(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return _mm_mul_ps(lhs, rhs);
+}
+
+inline auto abs(Float4 value) noexcept -> Float4 {
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+inline auto lessThan(Float4 lhs, Float4 rhs) noexcept -> Mask4 {
+	return _mm_cmplt_ps(lhs, rhs);
+}
+
+inline auto both(Mask4 lhs, Mask4 rhs) noexcept -> Mask4 {
+	return _mm_and_ps(lhs, rhs);
+}
+
+inline auto all(Mask4 mask) noexcept -> bool {
+	return _mm_movemask_ps(mask) == 0xf;
+}
+
+inline auto transpose(Float4 &row0, Float4 &row1, Float4 &row2, Float4 &row3) noexcept -> void {
+	_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+}
+
+#elif defined(KINOVAZED_SIMD_NEON)
+
+using Float4 = float32x4_t;
+using Mask4 = uint32x4_t;
+
+inline auto load(float const *data) noexcept -> Float4 {
+	return vld1q_f32(data);
+}
+
+inline auto store(float *data, Float4 value) noexcept -> void {
+	vst1q_f32(data, value);
+}
+
+inline auto set(float a, float b, float c, float d) noexcept -> Float4 {
+	float const values[] = {a, b, c, d};
+	return vld1q_f32(values);
+}
+
+inline auto splat(float value) noexcept -> Float4 {
+	return vdupq_n_f32(value);
+}
+
+inline auto add(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return vaddq_f32(lhs, rhs);
+}
+
+inline auto sub(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return vsubq_f32(lhs, rhs);
+}
+
+inline auto mul(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return vmulq_f32(lhs, rhs);
+}
+
+inline auto abs(Float4 value) noexcept -> Float4 {
+	return vabsq_f32(value);
+}
+
+inline auto lessThan(Float4 lhs, Float4 rhs) noexcept -> Mask4 {
+	return vcltq_f32(lhs, rhs);
+}
+
+inline auto both(Mask4 lhs, Mask4 rhs) noexcept -> Mask4 {
+	return vandq_u32(lhs, rhs);
+}
+
+inline auto all(Mask4 mask) noexcept -> bool {
+	auto const halves = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+	return (vget_lane_u32(halves, 0) & vget_lane_u32(halves, 1)) == 0xffffffffu;
+}
+
+inline auto transpose(Float4 &row0, Float4 &row1, Float4 &row2, Float4 &row3) noexcept -> void {
+	auto const upper = vtrnq_f32(row0, row1);
+	auto const lower = vtrnq_f32(row2, row3);
+	row0 = vcombine_f32(vget_low_f32(upper.val[0]), vget_low_f32(lower.val[0]));
+	row1 = vcombine_f32(vget_low_f32(upper.val[1]), vget_low_f32(lower.val[1]));
+	row2 = vcombine_f32(vget_high_f32(upper.val[0]), vget_high_f32(lower.val[0]));
+	row3 = vcombine_f32(vget_high_f32(upper.val[1]), vget_high_f32(lower.val[1]));
+}
+
+#else
+
+using Float4 = std::array<float, 4>;
+using Mask4 = std::array<bool, 4>;
+
+template<typename Operation>
+inline auto apply(Float4 lhs, Float4 rhs, Operation operation) noexcept {
+	auto result = std::array<decltype(operation(lhs[0], rhs[0])), 4>{};
+	for (auto lane = 0u; lane < 4; ++lane) {
+		result[lane] = operation(lhs[lane], rhs[lane]);
+	}
+	return result;
+}
+
+inline auto load(float const *data) noexcept -> Float4 {
+	return {data[0], data[1], data[2], data[3]};
+}
+
+inline auto store(float *data, Float4 value) noexcept -> void {
+	for (auto lane = 0u; lane < 4; ++lane) {
+		data[lane] = value[lane];
+	}
+}
+
+inline auto set(float a, float b, float c, float d) noexcept -> Float4 {
+	return {a, b, c, d};
+}
+
+inline auto splat(float value) noexcept -> Float4 {
+	return {value, value, value, value};
+}
+
+inline auto add(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return apply(lhs, rhs, [](auto l, auto r) { return l + r; });
+}
+
+inline auto sub(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return apply(lhs, rhs, [](auto l, auto r) { return l - r; });
+}
+
+inline auto mul(Float4 lhs, Float4 rhs) noexcept -> Float4 {
+	return apply(lhs, rhs, [](auto l, auto r) { return l * r; });
+}
+
+inline auto abs(Float4 value) noexcept -> Float4 {
+	return apply(value, value, [](auto l, auto) { return std::fabs(l); });
+}
+
+inline auto lessThan(Float4 lhs, Float4 rhs) noexcept -> Mask4 {
+	return apply(lhs, rhs, [](auto l, auto r) { return l < r; });
+}
+
+inline auto both(Mask4 lhs, Mask4 rhs) noexcept -> Mask4 {
+	return {lhs[0] && rhs[0], lhs[1] && rhs[1], lhs[2] && rhs[2], lhs[3] && rhs[3]};
+}
+
+inline auto all(Mask4 mask) noexcept -> bool {
+	return mask[0] && mask[1] && mask[2] && mask[3];
+}
+
+inline auto transpose(Float4 &row0, Float4 &row1, Float4 &row2, Float4 &row3) noexcept -> void {
+	auto const rows = std::array{row0, row1, row2, row3};
+	row0 = {rows[0][0], rows[1][0], rows[2][0], rows[3][0]};
+	row1 = {rows[0][1], rows[1][1], rows[2][1], rows[3][1]};
+	row2 = {rows[0][2], rows[1][2], rows[2][2], rows[3][2]};
+	row3 = {rows[0][3], rows[1][3], rows[2][3], rows[3][3]};
+}
+
+#endif
+
+} // namespace KinovaZED::Simd
+
+#endif
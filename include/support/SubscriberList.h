@@ -0,0 +1,106 @@
+#ifndef INCLUDE_SUPPORT_SUBSCRIBER_LIST_H_
+#define INCLUDE_SUPPORT_SUBSCRIBER_LIST_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace KinovaZED {
+
+/**
+ * A set of subscribers that can be changed from any thread while it is being notified
+ *
+ * The subscribers are kept in an immutable, sorted snapshot. Changing the set copies the current snapshot and
+ * atomically replaces it, while notifying only has to acquire the current snapshot once and then iterates over it
+ * without touching the reference counts of the individual subscribers. Subscribers that are removed during a
+ * notification still receive the events of the snapshot that was acquired before their removal.
+ *
+ * The snapshot is shared through std::atomic_load and std::atomic_store on a shared_ptr, since C++17 has no
+ * std::atomic<std::shared_ptr>. These are not lock-free: libstdc++ guards them with a mutex from a global lock pool,
+ * so every notification takes one uncontended lock and one reference count round trip on the snapshot. What it saves
+ * compared to a mutex-guarded std::set is the reference count round trip for every single subscriber. With a single
+ * subscriber it is therefore slower than the guarded set, and it only pays off from a handful of subscribers on.
+ */
+template<typename SubscriberType>
+struct SubscriberList {
+	using Pointer = std::shared_ptr<SubscriberType>;
+	using Snapshot = std::vector<Pointer>;
+
+	/**
+	 * Add a subscriber to the set
+	 *
+	 * @return Whether or not the subscriber was newly added
+	 */
+	auto add(Pointer subscriber) -> bool {
+		return update([&](Snapshot &subscribers) {
+			auto position = std::lower_bound(cbegin(subscribers), cend(subscribers), subscriber);
+			if (position != cend(subscribers) && *position == subscriber) {
+				return false;
+			}
+			subscribers.insert(position, std::move(subscriber));
+			return true;
+		});
+	}
+
+	/**
+	 * Remove a subscriber from the set
+	 *
+	 * @return Whether or not the subscriber was part of the set
+	 */
+	auto remove(Pointer const &subscriber) -> bool {
+		return update([&](Snapshot &subscribers) {
+			auto position = std::lower_bound(cbegin(subscribers), cend(subscribers), subscriber);
+			if (position == cend(subscribers) || *position != subscriber) {
+				return false;
+			}
+			subscribers.erase(position);
+			return true;
+		});
+	}
+
+	/**
+	 * Get the current set of subscribers
+	 */
+	auto snapshot() const -> std::shared_ptr<Snapshot const> {
+		return std::atomic_load_explicit(&current, std::memory_order_acquire);
+	}
+
+	/**
+	 * Invoke the given function with a reference to every subscriber in the current snapshot
+	 */
+	template<typename Function>
+	auto forEach(Function &&function) const -> void {
+		auto const subscribers = snapshot();
+		for (auto const &subscriber : *subscribers) {
+			function(*subscriber);
+		}
+	}
+
+	auto size() const -> std::size_t {
+		return snapshot()->size();
+	}
+
+  private:
+	template<typename Modification>
+	auto update(Modification &&modify) -> bool {
+		auto lock = std::lock_guard{writerMutex};
+		auto next = std::make_shared<Snapshot>(*snapshot());
+		if (!modify(*next)) {
+			return false;
+		}
+		std::atomic_store_explicit(&current, std::shared_ptr<Snapshot const>{std::move(next)}, std::memory_order_release);
+		return true;
+	}
+
+	std::shared_ptr<Snapshot const> current{std::make_shared<Snapshot const>()};
+	std::mutex writerMutex{};
+};
+
+} // namespace KinovaZED
+
+#endif
@@ -1,26 +1,41 @@
 #include "comm/TCPInterface.h"
 #include "control/CoreController.h"
+#include "control/EmbeddedObjectives.h"
 #include "control/HeartbeatGenerator.h"
 #include "control/ObjectiveManager.h"
+#include "hw/CurrentMonitor.h"
 #include "hw/KinovaArm.h"
+#include "hw/SimulatedArm.h"
+#include "hw/TelemetryRecorder.h"
 #include "support/LineCommandFactory.h"
 #include "support/Logging.h"
+#include "support/ExecutorPool.h"
 #include "support/Paths.h"
 #include "support/Prefix.h"
 
 #include <asio/io_context.hpp>
 #include <asio/signal_set.hpp>
+#include <lyra/cli_parser.hpp>
+#include <lyra/help.hpp>
+#include <lyra/opt.hpp>
 #include <signal.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdlib>
 #include <exception>
 #include <fstream>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
-#include <thread>
+#include <string>
+#include <vector>
 
 auto constexpr DEFAULT_PORT = 51717;
-auto constexpr MAXIMUM_RETRIES = 120;
 
 auto makeLogger() -> KinovaZED::Logger {
 	using namespace KinovaZED::Literals;
@@ -44,33 +59,178 @@ auto makeLogger() -> KinovaZED::Logger {
 	return KinovaZED::makeLogger(loggerConfig);
 }
 
-int main() {
-	using namespace std::chrono_literals;
+/**
+ * The tunable policies of the real arm
+ */
+struct ArmSettings {
+	KinovaZED::Hw::KinovaArm::PollingPolicy pollingPolicy{};
+	KinovaZED::Hw::KinovaArm::ReconnectPolicy reconnectPolicy{};
+	KinovaZED::Hw::CurrentMonitor::Limits currentLimits{};
+	std::chrono::milliseconds joystickOutputPeriod{10};
+};
+
+auto countOf(std::chrono::milliseconds duration) -> std::size_t {
+	return static_cast<std::size_t>(duration.count());
+}
+
+/**
+ * Parse a comma separated list of the currents of all joints, e.g. "1.5,1.5,1.5,1,1,1"
+ */
+auto parseJointCurrents(std::string const &text) -> std::optional<KinovaZED::Hw::CurrentMonitor::JointCurrents> {
+	auto currents = KinovaZED::Hw::CurrentMonitor::JointCurrents{};
+	auto stream = std::istringstream{text};
+	for (auto index = std::size_t{}; index < currents.size(); ++index) {
+		if ((index && stream.get() != ',') || !(stream >> currents[index])) {
+			return std::nullopt;
+		}
+	}
+	if (!(stream >> std::ws).eof()) {
+		return std::nullopt;
+	}
+	return currents;
+}
+
+auto makeArm(bool simulate, KinovaZED::ExecutorPool &executor, ArmSettings const &settings, KinovaZED::Logger logger)
+    -> std::unique_ptr<KinovaZED::Hw::Actor> {
+	if (simulate) {
+		logger->info("main: using a simulated arm");
+		return std::make_unique<KinovaZED::Hw::SimulatedArm>(executor, KinovaZED::Hw::SimulatedArm::Model{}, logger);
+	}
+	auto arm = std::make_unique<KinovaZED::Hw::KinovaArm>(executor, logger);
+	arm->setPollingPolicy(settings.pollingPolicy);
+	arm->setReconnectPolicy(settings.reconnectPolicy);
+	arm->setCurrentLimits(settings.currentLimits);
+	arm->setJoystickOutputPeriod(settings.joystickOutputPeriod);
+	return arm;
+}
+
+auto makeTelemetryRecorder(std::string path, std::size_t armIndex, std::size_t records, KinovaZED::Logger logger)
+    -> std::shared_ptr<KinovaZED::Hw::TelemetryRecorder> {
+	if (!records) {
+		return nullptr;
+	}
+
+	if (armIndex > 0) {
+		path += "." + std::to_string(armIndex);
+	}
+
+	try {
+		auto recorder = std::make_shared<KinovaZED::Hw::TelemetryRecorder>(path, records);
+		logger->info("main: recording telemetry of arm {} into '{}'", armIndex, path);
+		return recorder;
+	} catch (std::exception const &e) {
+		logger->warn("main: not recording telemetry of arm {}. reason: {}", armIndex, e.what());
+		return nullptr;
+	}
+}
+
+auto makeObjectiveManager(std::string const &path, KinovaZED::Logger logger)
+    -> KinovaZED::Control::ObjectiveManager {
+	if (path.empty() && !KinovaZED::Control::EMBEDDED_OBJECTIVES.empty()) {
+		logger->info("main: using the embedded objectives");
+		return KinovaZED::Control::ObjectiveManager{logger};
+	}
+
+	auto objectiveStream = std::ifstream{path.empty() ? KinovaZED::DEFAULT_OBJ_FILE_JSON : path};
+	return KinovaZED::Control::ObjectiveManager{objectiveStream, logger};
+}
+
+int main(int argc, char **argv) {
+	auto simulate{false};
+	auto showHelp{false};
+	auto threads = std::size_t{2};
+	auto simulatedArms = std::size_t{0};
+	auto telemetryFile = std::string{KinovaZED::DEFAULT_TELEMETRY_FILE};
+	auto telemetryRecords = std::size_t{65536};
+	auto objectivesFile = std::string{};
+
+	auto armSettings = ArmSettings{};
+	auto activePeriod = countOf(armSettings.pollingPolicy.activePeriod);
+	auto idlePeriod = countOf(armSettings.pollingPolicy.idlePeriod);
+	auto readsPerUpdate = armSettings.pollingPolicy.maximumReadsPerUpdate;
+	auto reconnectDelay = countOf(armSettings.reconnectPolicy.initialDelay);
+	auto maximumReconnectDelay = countOf(armSettings.reconnectPolicy.maximumDelay);
+	auto reconnectJitter = armSettings.reconnectPolicy.jitter;
+	auto reconnectAttempts = armSettings.reconnectPolicy.maximumAttempts;
+	auto softCurrents = std::string{};
+	auto hardCurrents = std::string{};
+	auto joystickPeriod = countOf(armSettings.joystickOutputPeriod);
+
+	auto cli = lyra::cli_parser() |                                                                                //
+	    lyra::opt(simulate)["--simulate"]("Drive a simulated arm instead of the real hardware") |                  //
+	    lyra::opt(threads, "count")["--threads"]("Number of threads shared by all arms") |                         //
+	    lyra::opt(simulatedArms, "count")["--simulated-arms"]("Number of additional simulated arms") |             //
+	    lyra::opt(telemetryFile, "path")["--telemetry"]("Ring file to record the arm telemetry into") |            //
+	    lyra::opt(telemetryRecords, "count")["--telemetry-records"]("Capacity of the ring file, 0 to disable") |   //
+	    lyra::opt(objectivesFile, "path")["--objectives"]("Objectives file overriding the embedded ones") |        //
+	    lyra::opt(activePeriod, "milliseconds")["--active-polling"]("Polling period while the arm is active") |    //
+	    lyra::opt(idlePeriod, "milliseconds")["--idle-polling"]("Polling period while the arm is idle") |          //
+	    lyra::opt(readsPerUpdate, "count")["--reads-per-update"]("USB reads per state update") |                   //
+	    lyra::opt(reconnectDelay, "milliseconds")["--reconnect-delay"]("Delay before the first reconnect") |       //
+	    lyra::opt(maximumReconnectDelay, "milliseconds")["--max-reconnect-delay"]("Maximal reconnect delay") |     //
+	    lyra::opt(reconnectJitter, "fraction")["--reconnect-jitter"]("Random reduction of reconnect delays") |     //
+	    lyra::opt(reconnectAttempts, "count")["--reconnect-attempts"]("Reconnect attempts, 0 to never give up") |  //
+	    lyra::opt(softCurrents, "amperes")["--soft-current-limits"]("Per-joint currents that pause movements") |   //
+	    lyra::opt(hardCurrents, "amperes")["--hard-current-limits"]("Per-joint currents that shut the arm down") | //
+	    lyra::opt(joystickPeriod, "milliseconds")["--joystick-period"]("Period of the joystick output") |          //
+	    lyra::help(showHelp);
+	auto result = cli.parse({argc, argv});
+
+	auto const soft = softCurrents.empty() ? armSettings.currentLimits.soft : parseJointCurrents(softCurrents);
+	auto const hard = hardCurrents.empty() ? armSettings.currentLimits.hard : parseJointCurrents(hardCurrents);
+	auto const isValid = soft && hard && activePeriod && idlePeriod && readsPerUpdate && joystickPeriod &&
+	    reconnectDelay <= maximumReconnectDelay && reconnectJitter >= 0.0 && reconnectJitter <= 1.0;
+
+	if (!result || showHelp || !isValid) {
+		std::cout << cli;
+		return result && isValid ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	armSettings.pollingPolicy.activePeriod = std::chrono::milliseconds{activePeriod};
+	armSettings.pollingPolicy.idlePeriod = std::chrono::milliseconds{idlePeriod};
+	armSettings.pollingPolicy.maximumReadsPerUpdate = readsPerUpdate;
+	armSettings.reconnectPolicy.initialDelay = std::chrono::milliseconds{reconnectDelay};
+	armSettings.reconnectPolicy.maximumDelay = std::chrono::milliseconds{maximumReconnectDelay};
+	armSettings.reconnectPolicy.jitter = reconnectJitter;
+	armSettings.reconnectPolicy.maximumAttempts = reconnectAttempts;
+	armSettings.currentLimits.soft = *soft;
+	armSettings.currentLimits.hard = *hard;
+	armSettings.joystickOutputPeriod = std::chrono::milliseconds{joystickPeriod};
 
 	auto logger = makeLogger();
 	logger->set_level(spdlog::level::info);
 	logger->info("main: starting up");
 
-	auto arm = std::make_unique<KinovaZED::Hw::KinovaArm>(logger);
-	auto retry{0};
+	auto executor = KinovaZED::ExecutorPool{threads};
+	logger->info("main: running {} arm(s) on {} thread(s)", 1 + simulatedArms, executor.size());
 
-	while (!arm->connect() && retry++ < MAXIMUM_RETRIES) {
-		std::this_thread::sleep_for(1s);
-	}
+	auto arms = std::vector<std::unique_ptr<KinovaZED::Hw::Actor>>{};
+	arms.push_back(makeArm(simulate, executor, armSettings, logger));
+	std::generate_n(back_inserter(arms), simulatedArms, [&] { return makeArm(true, executor, armSettings, logger); });
 
-	if (retry >= MAXIMUM_RETRIES) {
-		logger->error("main: arm did not connect in time.");
-		return EXIT_FAILURE;
+	for (auto index = std::size_t{}; index < arms.size(); ++index) {
+		arms[index]->setShouldReconnectOnError(true);
+		if (!arms[index]->connect()) {
+			logger->warn("main: arm {} is not available yet. reconnecting in the background", index);
+		}
 	}
 
-	arm->setShouldReconnectOnError(true);
-
 	auto ioContext = asio::io_context{};
 	auto interface = KinovaZED::Comm::TCPInterface{KinovaZED::lineCommandFactory, ioContext, DEFAULT_PORT, logger};
-	auto objectiveStream = std::ifstream{KinovaZED::DEFAULT_OBJ_FILE_JSON};
-	auto objectiveManager = KinovaZED::Control::ObjectiveManager{objectiveStream, logger};
-	auto controller = KinovaZED::Control::makeCoreController(interface, *arm, objectiveManager, logger);
-	auto heart = KinovaZED::Control::HeartbeatGenerator{interface, controller, ioContext, logger};
+	interface.setArmCount(arms.size());
+	auto objectiveManager = makeObjectiveManager(objectivesFile, logger);
+	auto controllers = std::vector<std::shared_ptr<KinovaZED::Control::CoreController>>{};
+	for (auto index = std::size_t{}; index < arms.size(); ++index) {
+		controllers.push_back(
+		    KinovaZED::Control::makeCoreController(interface, *arms[index], index, objectiveManager, logger));
+		if (auto recorder = makeTelemetryRecorder(telemetryFile, index, telemetryRecords, logger)) {
+			controllers.back()->setTelemetryRecorder(recorder);
+		}
+	}
+
+	auto heartbeatSources =
+	    std::vector<std::weak_ptr<KinovaZED::Control::CoreController>>{cbegin(controllers), cend(controllers)};
+	auto heart = KinovaZED::Control::HeartbeatGenerator{interface, heartbeatSources, ioContext, logger};
 
 	interface.start();
 	heart.start();
@@ -81,7 +241,7 @@ int main() {
 		if (error != asio::error::operation_aborted) {
 			interface.stop();
 			heart.stop();
-			arm.reset();
+			arms.clear();
 		}
 	});
 
@@ -0,0 +1,91 @@
+#include "hw/TelemetryRecorder.h"
+
+#include <lyra/arg.hpp>
+#include <lyra/cli_parser.hpp>
+#include <lyra/help.hpp>
+#include <lyra/opt.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using KinovaZED::Hw::TelemetryRecord;
+
+auto isSet(TelemetryRecord const &record, TelemetryRecord::Flags flag) -> bool {
+	return record.flags & flag;
+}
+
+auto writeCsv(std::vector<TelemetryRecord> const &records, std::ostream &out) -> void {
+	auto const code = [](std::uint8_t value) {
+		return value == TelemetryRecord::unknown ? std::string{} : std::to_string(value);
+	};
+
+	out << "sequence,timestamp,x,y,z,pitch,yaw,roll,current1,current2,current3,current4,current5,current6,"
+	       "retractionMode,movementStatus,controllerState,hasControl,hasFailed,isCurrentLimited\n";
+	for (auto const &record : records) {
+		out << record.sequence << ',' << record.timestamp;
+		for (auto value : record.position) {
+			out << ',' << value;
+		}
+		for (auto value : record.jointCurrents) {
+			out << ',' << value;
+		}
+		out << ',' << code(record.retractionMode) << ',' << code(record.movementStatus) << ','
+		    << static_cast<int>(record.controllerState) << ',' << isSet(record, TelemetryRecord::HasControl) << ','
+		    << isSet(record, TelemetryRecord::HasFailed) << ',' << isSet(record, TelemetryRecord::IsCurrentLimited)
+		    << '\n';
+	}
+}
+
+auto writeJson(std::vector<TelemetryRecord> const &records, std::ostream &out) -> void {
+	auto const code = [](std::uint8_t value) {
+		return value == TelemetryRecord::unknown ? nlohmann::json{} : nlohmann::json(value);
+	};
+
+	auto document = nlohmann::json::array();
+	for (auto const &record : records) {
+		document.push_back({
+		    {"sequence", record.sequence},
+		    {"timestamp", record.timestamp},
+		    {"position", record.position},
+		    {"jointCurrents", record.jointCurrents},
+		    {"retractionMode", code(record.retractionMode)},
+		    {"movementStatus", code(record.movementStatus)},
+		    {"controllerState", record.controllerState},
+		    {"hasControl", isSet(record, TelemetryRecord::HasControl)},
+		    {"hasFailed", isSet(record, TelemetryRecord::HasFailed)},
+		    {"isCurrentLimited", isSet(record, TelemetryRecord::IsCurrentLimited)},
+		});
+	}
+	out << document.dump(2) << '\n';
+}
+
+int main(int argc, char **argv) {
+	auto file = std::string{};
+	auto json{false};
+	auto showHelp{false};
+
+	auto cli = lyra::cli_parser() |                                               //
+	    lyra::arg(file, "file")("The telemetry ring file to decode").required() | //
+	    lyra::opt(json)["--json"]("Write JSON instead of CSV") |                  //
+	    lyra::help(showHelp);
+	auto result = cli.parse({argc, argv});
+
+	if (!result || showHelp) {
+		std::cout << cli;
+		return result ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	try {
+		auto const records = KinovaZED::Hw::readTelemetryFile(file);
+		json ? writeJson(records, std::cout) : writeCsv(records, std::cout);
+	} catch (std::exception const &e) {
+		std::cerr << "failed to decode telemetry. reason: " << e.what() << '\n';
+		return EXIT_FAILURE;
+	}
+}
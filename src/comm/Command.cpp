@@ -32,11 +32,20 @@ auto constexpr commandNames = std::array{
     std::pair{Command::Id::SetActiveObjective, "SetActiveObjective"},
     std::pair{Command::Id::GetObjectivePosition, "GetObjectivePosition"},
     std::pair{Command::Id::GetAbsolutePosition, "GetAbsolutePosition"},
+    std::pair{Command::Id::GetUpdateStatistics, "GetUpdateStatistics"},
+    std::pair{Command::Id::GetTransactionStatistics, "GetTransactionStatistics"},
 };
 
 static_assert(enumNameMappingsAreUnique(commandNames), "Duplicate entry in name map!");
 static_assert(enumNameMapHasAllEntries(commandNames, Command::Id::Initialize), "Missing entry in name map!");
 
+auto Command::isAddressedTo(std::size_t index) const -> bool {
+	if (!arm) {
+		return id == Id::EStop || index == 0;
+	}
+	return *arm == index;
+}
+
 auto isKnownCommandId(int candidate) -> bool {
 	return candidate >= 0 && candidate < static_cast<int>(Command::Id::END_OF_ENUM);
 }
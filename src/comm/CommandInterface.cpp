@@ -5,9 +5,8 @@
 #include "comm/Heartbeat.h"
 #include "comm/Notification.h"
 
-#include <algorithm>
 #include <cassert>
-#include <iterator>
+#include <utility>
 
 namespace KinovaZED::Comm {
 
@@ -17,22 +16,26 @@ CommandInterface::CommandInterface(CommandFactory commandFactory)
 
 auto CommandInterface::start() -> void {
 	doStart();
-	std::for_each(begin(subscribers), end(subscribers), [&](auto subscriber) { subscriber->onInterfaceStarted(); });
+	subscribers.forEach([](auto &subscriber) { subscriber.onInterfaceStarted(); });
 }
 
 auto CommandInterface::stop() -> void {
 	doStop();
-	std::for_each(begin(subscribers), end(subscribers), [&](auto subscriber) { subscriber->onInterfaceStopped(); });
+	subscribers.forEach([](auto &subscriber) { subscriber.onInterfaceStopped(); });
 }
 
 auto CommandInterface::subscribe(SubscriberPointer subscriber) -> bool {
 	assert(subscriber);
-	return subscribers.insert(subscriber).second;
+	return subscribers.add(std::move(subscriber));
 }
 
 auto CommandInterface::unsubscribe(SubscriberPointer subscriber) -> bool {
 	assert(subscriber);
-	return subscribers.erase(subscriber);
+	return subscribers.remove(subscriber);
+}
+
+auto CommandInterface::setArmCount(std::size_t count) -> void {
+	armCount = count;
 }
 
 auto CommandInterface::send(Notification message) -> void {
@@ -44,7 +47,12 @@ auto CommandInterface::send(Heartbeat message) -> void {
 }
 
 auto CommandInterface::notifySubscribers(Command command) -> void {
-	std::for_each(begin(subscribers), end(subscribers), [&](auto subscriber) { subscriber->process(command); });
+	if (command.arm && armCount && *command.arm >= *armCount) {
+		send(Notification{Notification::Id::Rejected, *command.arm});
+		return;
+	}
+
+	subscribers.forEach([&](auto &subscriber) { subscriber.process(command); });
 }
 
 auto CommandInterface::makeCommand(std::string data) -> std::invoke_result_t<CommandFactory, std::string> {
@@ -11,7 +11,10 @@ namespace KinovaZED {
 
 template<>
 auto toString(Comm::Heartbeat const &heartbeat) -> std::string {
-	return fmt::format("Heartbeat:{}", heartbeat.state.to_ulong());
+	if (!heartbeat.arm) {
+		return fmt::format("Heartbeat:{}", heartbeat.state.to_ulong());
+	}
+	return fmt::format("Heartbeat@{}:{}", heartbeat.arm, heartbeat.state.to_ulong());
 }
 
 } // namespace KinovaZED
\ No newline at end of file
@@ -3,9 +3,12 @@
 #include "support/EnumUtils.h"
 #include "support/ToString.h"
 
+#include <spdlog/fmt/fmt.h>
+
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <iterator>
 
 namespace KinovaZED::Comm {
@@ -25,14 +28,19 @@ auto constexpr idNames = std::array{
 static_assert(enumNameMappingsAreUnique(idNames), "Duplicate entry in name map!");
 static_assert(enumNameMapHasAllEntries(idNames, Notification::Id::JoystickModeSet), "Missing entry in name map!");
 
-Notification::Notification(Id id)
-    : id{id} {
+Notification::Notification(Id id, std::size_t arm)
+    : id{id}
+    , arm{arm} {
 }
 
 auto Notification::getId() const noexcept -> Id {
 	return id;
 }
 
+auto Notification::getArm() const noexcept -> std::size_t {
+	return arm;
+}
+
 auto isKnownNotificationId(int candidate) -> bool {
 	return candidate >= 0 && candidate < static_cast<int>(Notification::Id::END_OF_ENUM);
 }
@@ -45,7 +53,10 @@ using namespace Comm;
 
 template<>
 auto toString(Notification const &notification) -> std::string {
-	return toString(notification.getId());
+	if (!notification.getArm()) {
+		return toString(notification.getId());
+	}
+	return fmt::format("{}@{}", toString(notification.getId()), notification.getArm());
 }
 
 template<>
@@ -5,16 +5,23 @@
 #include "control/ObjectiveManager.h"
 #include "hw/Actor.h"
 #include "hw/Coordinates.h"
-#include "math/Matrix.h"
+#include "hw/Origin.h"
+#include "math/Pose.h"
+#include "support/Expected.h"
 
 #include <sml/sml.hpp>
 #include <spdlog/fmt/fmt.h>
 
 #include <bitset>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace KinovaZED::Control {
 
@@ -31,11 +38,13 @@ auto extractJoystickPosition(Comm::Command command) -> std::tuple<int, int, int>
 
 CoreController::CoreController(Comm::CommandInterface &interface,
                                Hw::Actor &actor,
+                               std::size_t armIndex,
                                ObjectiveManager &objectiveManager,
                                Logger logger)
     : LoggingMixin{logger, "CoreController"}
     , commandSource(interface)
     , arm{actor}
+    , armIndex{armIndex}
     , objectiveManager{objectiveManager}
     , stateMachine{CoreStateMachine{logger}} {
 }
@@ -44,16 +53,21 @@ auto CoreController::process(Comm::Command command) -> void {
 	using namespace Comm;
 	using namespace std::placeholders;
 
-	auto currentSteeringMode = arm.getSteeringMode();
-	logInfo("process",
-	        "current steering mode of the arm is: {}",
-	        currentSteeringMode ? toString(*currentSteeringMode) : "unknown");
+	if (!command.isAddressedTo(armIndex)) {
+		return;
+	}
+
+	arm.asyncGetSteeringMode([that = shared_from_this()](auto currentSteeringMode) {
+		that->logInfo("process",
+		              "current steering mode of the arm is: {}",
+		              currentSteeringMode ? toString(*currentSteeringMode) : "unknown");
+	});
 
 	auto logStepper = makeLoggedStepper("process");
 	auto logStep = [logStepper, that = shared_from_this()](auto event, auto success, auto error) {
 		auto result = logStepper(event, success, error);
-		that->commandSource.send(
-		    Comm::Notification{result ? Comm::Notification::Id::Accepted : Comm::Notification::Id::Rejected});
+		that->commandSource.send(Comm::Notification{
+		    result ? Comm::Notification::Id::Accepted : Comm::Notification::Id::Rejected, that->armIndex});
 		return result;
 	};
 
@@ -63,6 +77,7 @@ auto CoreController::process(Comm::Command command) -> void {
 		isInitialized = !logStep(CoreStateMachine::Event::EStop{arm},
 		                         "entered emergency stop state",
 		                         "internal state machine refused to enter emergency stop.");
+		publishControllerState();
 		break;
 	case Command::Id::QuitEStop:
 		logStep(CoreStateMachine::Event::QuitEStop{arm},
@@ -76,7 +91,24 @@ auto CoreController::process(Comm::Command command) -> void {
 		}
 		auto point = currentObjective->nextPoint();
 		auto name = toString(currentObjective->getId());
-		logStep(CoreStateMachine::Event ::RunObjective{arm, *point},
+		if (!point) {
+			logError("process", "objective '{}' has no waypoints", name);
+			abortObjective("process");
+			break;
+		}
+		if (!*point) {
+			logError("process", "objective '{}' starts with an unreachable waypoint", name);
+			abortObjective("process");
+			break;
+		}
+		auto lookahead = collectLookahead();
+		if (!lookahead) {
+			logError("process", "objective '{}' has an unreachable waypoint within the lookahead", name);
+			abortObjective("process");
+			break;
+		}
+		waypointsInFlight = 1 + lookahead->size();
+		logStep(CoreStateMachine::Event ::RunObjective{arm, **point, *lookahead},
 		        fmt::format("moving toward objective '{}'", name),
 		        fmt::format("internal state machine refused to move toward objective '{}'", name));
 	} break;
@@ -113,48 +145,65 @@ auto CoreController::process(Comm::Command command) -> void {
 		if (logStep(CoreStateMachine::Event::Freeze{arm},
 		            "freezing the arm",
 		            "internal state machine refused to freeze the arm")) {
-			commandSource.send(Comm::Notification{Comm::Notification::Id::Freezed});
+			commandSource.send(Comm::Notification{Comm::Notification::Id::Freezed, armIndex});
 		}
 		break;
 	case Command::Id::Unfreeze:
 		if (logStep(CoreStateMachine::Event::Thaw{arm},
 		            "thawing the arm",
 		            "internal state machine refused to thaw the arm")) {
-			commandSource.send(Comm::Notification{Comm::Notification::Id::Unfreezed});
+			commandSource.send(Comm::Notification{Comm::Notification::Id::Unfreezed, armIndex});
 		}
 		break;
-	case Command::Id::GetAbsolutePosition: {
-		auto position = arm.getPosition();
-		auto [x, y, z, pitch, yaw, roll] = position;
-		logInfo("process",
-		        "Current arm position (abs): {{ \"X\":  {}, \"Y\":  {}, \"Z\":  {}, \"pitch\":  {}, \"yaw\":  {}, "
-		        "\"roll\":  {} }}",
-		        x,
-		        y,
-		        z,
-		        pitch,
-		        yaw,
-		        roll);
-	} break;
+	case Command::Id::GetAbsolutePosition:
+		arm.asyncGetPosition([that = shared_from_this()](auto position) {
+			that->logInfo("process",
+			              "Current arm position (abs): {{ \"X\":  {}, \"Y\":  {}, \"Z\":  {}, \"pitch\":  {}, "
+			              "\"yaw\":  {}, \"roll\":  {} }}",
+			              position.x,
+			              position.y,
+			              position.z,
+			              position.pitch,
+			              position.yaw,
+			              position.roll);
+		});
+		break;
+	case Command::Id::GetUpdateStatistics:
+		arm.asyncGetUpdateStatistics([that = shared_from_this()](auto statistics) {
+			that->logInfo("process", "Current update loop statistics: {}", toString(statistics));
+		});
+		break;
+	case Command::Id::GetTransactionStatistics:
+		arm.asyncGetTransactionStatistics([that = shared_from_this()](auto statistics) {
+			that->logInfo("process", "Current USB transaction statistics: {}", toString(statistics));
+		});
+		break;
 	case Command::Id::GetObjectivePosition: {
 		if (!currentObjective) {
 			logError("process", "Tried to get objective position without an active objective!");
 			break;
 		}
-		auto position = arm.getPosition();
-		auto origin = currentObjective->getOrigin();
-		auto transformationMatrix = origin.getInvertedTransformationMatrix();
-		auto transformedPosition = coordTransform(position, transformationMatrix);
-		auto [x, y, z, pitch, yaw, roll] = transformedPosition;
-		logInfo("process",
-		        "Current arm position (obj): {{ \"X\":  {}, \"Y\":  {}, \"Z\":  {}, \"pitch\":  {}, \"yaw\":  {}, "
-		        "\"roll\":  {} }}",
-		        x,
-		        y,
-		        z,
-		        pitch,
-		        yaw,
-		        roll);
+		// Taught positions are written into the objectives file, so they are captured in double precision
+		auto origin = Hw::BasicOrigin<double>{currentObjective->getOrigin().getCoordinates()};
+		arm.asyncGetPosition([that = shared_from_this(), origin](auto position) {
+			auto transformedPosition =
+			    (origin.getInvertedPose() * BasicPose<double>::fromCoordinates(position)).toCoordinates();
+			if (!transformedPosition) {
+				that->logWarning("process",
+				                 "Current arm position is not reachable in the objective's frame. reason: {}",
+				                 toString(transformedPosition.error()));
+				return;
+			}
+			that->logInfo("process",
+			              "Current arm position (obj): {{ \"X\":  {}, \"Y\":  {}, \"Z\":  {}, \"pitch\":  {}, "
+			              "\"yaw\":  {}, \"roll\":  {} }}",
+			              transformedPosition->x,
+			              transformedPosition->y,
+			              transformedPosition->z,
+			              transformedPosition->pitch,
+			              transformedPosition->yaw,
+			              transformedPosition->roll);
+		});
 	} break;
 	case Command::Id::SetActiveObjective: {
 		currentObjective = objectiveManager.getObjective(std::any_cast<Objective::Id>(command.parameters[0]));
@@ -180,19 +229,30 @@ auto CoreController::onPositionReached(Hw::Actor &, Hw::Coordinates) -> void {
 	}
 
 	assert(currentObjective);
+	waypointsInFlight -= static_cast<std::size_t>(waypointsInFlight > 0);
 	auto nextPoint = currentObjective->nextPoint();
 
-	if (nextPoint) {
-		if (stateMachine.is(CoreStateMachine::runningSequence)) {
-			logStep(CoreStateMachine::Event::RunObjective{arm, *nextPoint},
+	if (nextPoint && !*nextPoint) {
+		logError("onPositionReached",
+		         "objective '{}' continues with an unreachable waypoint",
+		         toString(currentObjective->getId()));
+		abortObjective("onPositionReached");
+	} else if (nextPoint) {
+		++waypointsInFlight;
+		if (waypointLookahead) {
+			logStep(CoreStateMachine::Event::QueueWaypoint{arm, **nextPoint},
+			        "queuing next sequence point",
+			        "internal state machine refused to queue next sequence point");
+		} else {
+			logStep(CoreStateMachine::Event::RunObjective{arm, **nextPoint},
 			        "moving towards next sequence point",
 			        "internal state machine refused to move towards next sequence point");
 		}
-	} else {
+	} else if (!waypointsInFlight) {
 		if (logStep(CoreStateMachine::Event::SequenceFinished{arm},
 		            "finishing movement sequence",
 		            "internal state machine did not accept sequence end event")) {
-			commandSource.send(Comm::Notification{Comm::Notification::Id::ObjectiveDone});
+			commandSource.send(Comm::Notification{Comm::Notification::Id::ObjectiveDone, armIndex});
 		}
 	}
 }
@@ -203,7 +263,7 @@ auto CoreController::onHomeReached(Hw::Actor &) -> void {
 	if (logStep(CoreStateMachine::Event::Unfolded{},
 	            "marking the arm as being at home position",
 	            "internal state machine did not accept unfolded event")) {
-		commandSource.send(Comm::Notification{Comm::Notification::Id::Unfolded});
+		commandSource.send(Comm::Notification{Comm::Notification::Id::Unfolded, armIndex});
 	}
 }
 
@@ -213,7 +273,7 @@ auto CoreController::onRetractionPointReached(Hw::Actor &) -> void {
 	logStep(CoreStateMachine::Event::Retracted{},
 	        "marking the arm as being in the retracted",
 	        "internal state machine did not accept retracted event");
-	commandSource.send(Comm::Notification{Comm::Notification::Id::Retracted});
+	commandSource.send(Comm::Notification{Comm::Notification::Id::Retracted, armIndex});
 }
 
 auto CoreController::onSteeringModeChanged(Hw::Actor &, Hw::SteeringMode mode) -> void {
@@ -223,13 +283,14 @@ auto CoreController::onSteeringModeChanged(Hw::Actor &, Hw::SteeringMode mode) -
 	if (logStep(CoreStateMachine::Event::ModeSet{mode},
 	            "changed steering mode",
 	            "internal state machine did not accept steering mode change")) {
-		commandSource.send(Comm::Notification{Comm::Notification::Id::JoystickModeSet});
+		commandSource.send(Comm::Notification{Comm::Notification::Id::JoystickModeSet, armIndex});
 	}
 }
 
 auto CoreController::onReconnectedDueToError(Hw::Actor &arm) -> void {
 	isInitialized = false;
 	stateMachine.process_event(CoreStateMachine::Event::EStop{arm});
+	publishControllerState();
 }
 
 auto CoreController::onInitializationFinished(Hw::Actor &) -> void {
@@ -238,14 +299,59 @@ auto CoreController::onInitializationFinished(Hw::Actor &) -> void {
 	if ((isInitialized = logStep(CoreStateMachine::Event::Initialized{},
 	                             "marking the arm as initialized",
 	                             "internal state machine did not accept initialized event"))) {
-		commandSource.send(Comm::Notification{Comm::Notification::Id::Initialized});
+		publishControllerState();
+		commandSource.send(Comm::Notification{Comm::Notification::Id::Initialized, armIndex});
+	}
+}
+
+auto CoreController::setWaypointLookahead(std::size_t count) -> void {
+	logInfo("setWaypointLookahead", "queuing up to {} waypoints ahead of the current target", count);
+	waypointLookahead = count;
+}
+
+auto CoreController::collectLookahead() -> Expected<std::vector<Hw::Coordinates>, Hw::CoordinateError> {
+	auto lookahead = std::vector<Hw::Coordinates>{};
+	while (lookahead.size() < waypointLookahead) {
+		auto point = currentObjective->nextPoint();
+		if (!point) {
+			break;
+		}
+		if (!*point) {
+			return Unexpected{point->error()};
+		}
+		lookahead.push_back(**point);
+	}
+	return lookahead;
+}
+
+auto CoreController::abortObjective(std::string function) -> void {
+	auto logStep = makeLoggedStepper(function);
+
+	currentObjective.reset();
+	waypointsInFlight = 0;
+	if (stateMachine.is(CoreStateMachine::runningSequence)) {
+		logStep(CoreStateMachine::Event::AbortSequence{arm},
+		        "aborting movement sequence",
+		        "internal state machine refused to abort the movement sequence");
 	}
+	commandSource.send(Comm::Notification{Comm::Notification::Id::Rejected, armIndex});
 }
 
 auto CoreController::getSystemState() -> std::bitset<8> {
+	auto state = controllerState();
+	state.set(0, !arm.hasFailed());
+	return state;
+}
+
+auto CoreController::setTelemetryRecorder(std::shared_ptr<Hw::TelemetryRecorder> recorder) -> void {
+	std::atomic_store(&telemetryRecorder, recorder);
+	publishControllerState();
+	arm.setTelemetryRecorder(std::move(recorder));
+}
+
+auto CoreController::controllerState() -> std::bitset<8> {
 	auto state = std::bitset<8>{};
 
-	state.set(0, !arm.hasFailed());
 	state.set(1, stateMachine.is(CoreStateMachine::emergencyStopped));
 	state.set(2, isInitialized);
 	state.set(3, stateMachine.is(CoreStateMachine::frozen));
@@ -257,6 +363,16 @@ auto CoreController::getSystemState() -> std::bitset<8> {
 	return state;
 }
 
+auto CoreController::publishControllerState() -> void {
+	if (auto recorder = std::atomic_load(&telemetryRecorder)) {
+		recorder->setControllerState(static_cast<std::uint8_t>(controllerState().to_ulong()));
+	}
+}
+
+auto CoreController::getArmIndex() const noexcept -> std::size_t {
+	return armIndex;
+}
+
 struct CoreControllerCtorAccess : CoreController {
 	template<typename... Args>
 	CoreControllerCtorAccess(Args &&... args)
@@ -273,9 +389,10 @@ struct CoreControllerCtorAccess : CoreController {
 
 auto makeCoreController(Comm::CommandInterface &interface,
                         Hw::Actor &actor,
+                        std::size_t armIndex,
                         ObjectiveManager &objectiveManager,
                         Logger logger) -> std::shared_ptr<CoreController> {
-	auto handler = std::make_shared<CoreControllerCtorAccess>(interface, actor, objectiveManager, logger);
+	auto handler = std::make_shared<CoreControllerCtorAccess>(interface, actor, armIndex, objectiveManager, logger);
 	handler->enableSubscriptions();
 	return handler;
 }
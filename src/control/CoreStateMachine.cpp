@@ -5,62 +5,86 @@
 namespace KinovaZED::Control {
 
 auto CoreStateMachine::Event::Initialize::operator()() const -> void {
-	if (actor.takeControl()) {
-		actor.initialize();
-	}
+	actor.asyncTakeControl([&actor = actor](bool gainedControl) {
+		if (gainedControl) {
+			actor.asyncInitialize({});
+		}
+	});
 }
 
 auto CoreStateMachine::Event::Freeze::operator()() const -> void {
-	actor.stopMoving();
+	actor.asyncStopMoving({});
 }
 
 auto CoreStateMachine::Event::Thaw::operator()() const -> void {
 }
 
 auto CoreStateMachine::Event::EStop::operator()() const -> void {
-	actor.stopMoving();
-	actor.releaseControl();
+	actor.asyncStopMoving([&actor = actor](bool) { actor.asyncReleaseControl({}); });
 }
 
 auto CoreStateMachine::Event::QuitEStop::operator()() const -> void {
 }
 
 auto CoreStateMachine::Event::Retract::operator()() const -> void {
-	actor.retract();
+	actor.asyncRetract({});
 }
 
 auto CoreStateMachine::Event::Unfold::operator()() const -> void {
-	actor.home();
+	actor.asyncHome({});
 }
 
 auto CoreStateMachine::Event::SetJoystickMode::operator()() const -> void {
-	actor.stopMoving();
-	actor.setSteeringMode(mode);
+	actor.asyncStopMoving([&actor = actor, mode = mode](bool stopped) {
+		// A stop that was superseded by another one must not undo it
+		if (stopped) {
+			actor.asyncSetSteeringMode(mode, {});
+		}
+	});
 }
 
 auto CoreStateMachine::Event::RunObjective::operator()() const -> void {
-	actor.stopMoving();
-	actor.moveTo(position);
+	actor.asyncStopMoving([&actor = actor, position = position, lookahead = lookahead](bool stopped) {
+		// A stop that was superseded by another one must not undo it
+		if (!stopped) {
+			return;
+		}
+		actor.asyncMoveTo(position, {});
+		for (auto const &waypoint : lookahead) {
+			actor.asyncAppendTarget(waypoint, {});
+		}
+	});
 }
 
-auto CoreStateMachine::Event::JoystickMoved::operator()() const -> void {
-	auto currentPosition = actor.getPosition();
-	auto boundedX = x, boundedY = y;
-
-	// TODO: Refactor to Coordinates.h
-	if ((x > 0 && currentPosition.x <= (-absoluteLimitX + 0.01)) || (x < 0 && currentPosition.x >= (absoluteLimitX - 0.01))) {
-		boundedX = 0;
-	}
-
-	if ((y > 0 && currentPosition.y <= (-absoluteLimitY + 0.01)) || (y < 0 && currentPosition.y >= (absoluteLimitY - 0.01))) {
-		boundedY = 0;
-	}
+auto CoreStateMachine::Event::QueueWaypoint::operator()() const -> void {
+	actor.asyncAppendTarget(position, {});
+}
 
-	actor.setJoystick(boundedX, boundedY, z);
+auto CoreStateMachine::Event::JoystickMoved::operator()() const -> void {
+	actor.asyncGetPosition([&actor = actor, x = x, y = y, z = z](auto currentPosition) {
+		auto boundedX = x, boundedY = y;
+
+		// TODO: Refactor to Coordinates.h
+		if ((x > 0 && currentPosition.x <= (-absoluteLimitX + 0.01)) ||
+		    (x < 0 && currentPosition.x >= (absoluteLimitX - 0.01))) {
+			boundedX = 0;
+		}
+
+		if ((y > 0 && currentPosition.y <= (-absoluteLimitY + 0.01)) ||
+		    (y < 0 && currentPosition.y >= (absoluteLimitY - 0.01))) {
+			boundedY = 0;
+		}
+
+		actor.asyncSetJoystick(boundedX, boundedY, z, {});
+	});
 }
 
 auto CoreStateMachine::Event::SequenceFinished::operator()() const -> void {
-	actor.stopMoving();
+	// The arm already came to rest at the last waypoint, and its trajectory FIFO is empty
+}
+
+auto CoreStateMachine::Event::AbortSequence::operator()() const -> void {
+	actor.asyncStopMoving({});
 }
 
 } // namespace KinovaZED::Control
\ No newline at end of file
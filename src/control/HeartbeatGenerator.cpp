@@ -11,6 +11,8 @@
 
 #include <chrono>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace KinovaZED::Control {
 
@@ -18,9 +20,16 @@ HeartbeatGenerator::HeartbeatGenerator(Comm::CommandInterface &sink,
                                        std::weak_ptr<CoreController> controller,
                                        asio::io_context &timerContext,
                                        Logger logger)
+    : HeartbeatGenerator{sink, std::vector{controller}, timerContext, logger} {
+}
+
+HeartbeatGenerator::HeartbeatGenerator(Comm::CommandInterface &sink,
+                                       std::vector<std::weak_ptr<CoreController>> controllers,
+                                       asio::io_context &timerContext,
+                                       Logger logger)
     : LoggingMixin{logger, "HeartbeatGenerator"}
     , sink{sink}
-    , controller{controller}
+    , controllers{std::move(controllers)}
     , timerContext{timerContext} {
 }
 
@@ -51,12 +60,15 @@ auto HeartbeatGenerator::beat() -> void {
 			return;
 		}
 
-		if (auto locked = controller.lock(); locked) {
-			auto state = locked->getSystemState();
-			logDebug("<beat::lambda>", "sending heartbeat: {}", state.to_ulong());
-			sink.send(Comm::Heartbeat{state});
-		} else {
-			logError("<beat::lambda>", "failed to access core controller");
+		for (auto const &controller : controllers) {
+			if (auto locked = controller.lock(); locked) {
+				auto state = locked->getSystemState();
+				auto arm = locked->getArmIndex();
+				logDebug("<beat::lambda>", "sending heartbeat for arm {}: {}", arm, state.to_ulong());
+				sink.send(Comm::Heartbeat{state, arm});
+			} else {
+				logError("<beat::lambda>", "failed to access core controller");
+			}
 		}
 
 		beat();
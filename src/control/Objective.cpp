@@ -1,6 +1,5 @@
 #include "control/Objective.h"
 
-#include "math/Matrix.h"
 #include "support/EnumUtils.h"
 
 #include <nlohmann/json.hpp>
@@ -49,11 +48,22 @@ auto constexpr jsonKeyOrigin = "origin";
 auto constexpr jsonKeySequence = "sequence";
 
 Objective::Objective(nlohmann::json const &json, Logger logger)
+    : Objective{fromString<Id>(json[jsonKeyName].get<std::string>()),
+                json[jsonKeyOrigin].get<Hw::Coordinates>(),
+                json[jsonKeySequence].get<std::vector<Hw::Coordinates>>(),
+                json[jsonKeyIsAbs].get<bool>(),
+                logger} {
+}
+
+Objective::Objective(Id id, Hw::Coordinates origin, std::vector<Hw::Coordinates> sequence, bool absolute, Logger logger)
     : LoggingMixin{logger, "Objective"}
-    , id{fromString<Id>(json[jsonKeyName].get<std::string>())}
-    , origin{json[jsonKeyOrigin].get<Hw::Coordinates>()}
-    , sequence{json[jsonKeySequence].get<std::vector<Hw::Coordinates>>()}
-    , absolute{json[jsonKeyIsAbs].get<bool>()} {
+    , id{id}
+    , origin{origin}
+    , sequence{std::move(sequence)}
+    , absolute{absolute} {
+	waypoints.reserve(this->sequence.size());
+	std::transform(cbegin(this->sequence), cend(this->sequence), back_inserter(waypoints), Pose::fromCoordinates);
+	transformWaypoints();
 	logInfo("<ctor>", "loaded objective '{0}'", toString(id));
 }
 
@@ -63,17 +73,33 @@ auto Objective::getOrigin() const -> Hw::Origin {
 
 auto Objective::setOrigin(Hw::Coordinates point) -> void {
 	origin = Hw::Origin{point};
+	transformWaypoints();
 }
 
-auto Objective::nextPoint() -> std::optional<Hw::Coordinates> {
+auto Objective::nextPoint() -> std::optional<Expected<Hw::Coordinates, Hw::CoordinateError>> {
 	++currentSequenceIndex;
-	if (currentSequenceIndex < static_cast<decltype(currentSequenceIndex)>(sequence.size())) {
-		auto coordinates = sequence[currentSequenceIndex];
-		return coordTransform(coordinates, origin.getTransformationMatrix());
+	if (currentSequenceIndex < static_cast<decltype(currentSequenceIndex)>(targets.size())) {
+		auto const &transformed = targets[currentSequenceIndex];
+		if (!transformed) {
+			logError("nextPoint",
+			         "waypoint {0} of objective '{1}' is not reachable from the current origin. reason: {2}",
+			         currentSequenceIndex,
+			         toString(id),
+			         toString(transformed.error()));
+		}
+		return transformed;
 	}
 	return std::nullopt;
 }
 
+auto Objective::transformWaypoints() -> void {
+	targets.clear();
+	targets.reserve(waypoints.size());
+	std::transform(cbegin(waypoints), cend(waypoints), back_inserter(targets), [&](auto const &waypoint) {
+		return (origin.getPose() * waypoint).toCoordinates();
+	});
+}
+
 auto Objective::getId() const -> Id {
 	return id;
 }
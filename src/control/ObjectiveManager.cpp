@@ -1,17 +1,26 @@
 #include "control/ObjectiveManager.h"
 
+#include "control/EmbeddedObjectives.h"
 #include "control/Objective.h"
+#include "hw/Coordinates.h"
 #include "support/Logging.h"
 
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
 #include <iterator>
+#include <utility>
+#include <vector>
 
 namespace KinovaZED::Control {
 
-ObjectiveManager::ObjectiveManager(std::istream &in, Logger logger)
+ObjectiveManager::ObjectiveManager(Logger logger)
     : LoggingMixin{logger, "ObjectiveManager"} {
+	loadEmbeddedObjectives();
+}
+
+ObjectiveManager::ObjectiveManager(std::istream &in, Logger logger)
+    : ObjectiveManager{logger} {
 	if (in.peek() != std::remove_reference_t<decltype(in)>::traits_type::eof()) {
 		logInfo("<ctor>", "loading objectives");
 		loadObjectives(in);
@@ -26,6 +35,20 @@ auto ObjectiveManager::getObjective(Objective::Id id) -> Objective & {
 	return objectives.at(id);
 }
 
+auto ObjectiveManager::loadEmbeddedObjectives() -> void {
+	std::for_each(cbegin(EMBEDDED_OBJECTIVES), cend(EMBEDDED_OBJECTIVES), [&](auto const &embedded) {
+		auto const first = std::next(cbegin(EMBEDDED_WAYPOINTS), embedded.firstWaypoint);
+		auto sequence = std::vector<Hw::Coordinates>(first, std::next(first, embedded.numberOfWaypoints));
+		auto objective = Objective{
+		    embedded.id, Hw::Coordinates{embedded.origin}, std::move(sequence), embedded.absolute, getLogger()};
+		objectives.emplace(objective.getId(), objective);
+	});
+
+	if (!objectives.empty()) {
+		logInfo("loadEmbeddedObjectives", "loaded {} embedded objectives", objectives.size());
+	}
+}
+
 auto ObjectiveManager::loadObjectives(std::istream &in) -> void {
 	auto json = nlohmann::json::parse(in);
 
@@ -36,10 +59,12 @@ auto ObjectiveManager::loadObjectives(std::istream &in) -> void {
 
 	for_each(cbegin(json), cend(json), [&](auto const &element) {
 		auto objective = Objective{element, getLogger()};
-		objectives.emplace(objective.getId(), objective);
+		if (!objectives.insert_or_assign(objective.getId(), objective).second) {
+			logInfo("loadObjectives", "replaced objective '{0}'", toString(objective.getId()));
+		}
 	});
 
-	logInfo("loadObjectives", "loaded {} objectives", objectives.size());
+	logInfo("loadObjectives", "loaded {} objectives", json.size());
 }
 
 } // namespace KinovaZED::Control
\ No newline at end of file
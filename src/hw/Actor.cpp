@@ -7,6 +7,9 @@
 #include <cassert>
 #include <future>
 #include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace KinovaZED::Hw {
 
@@ -21,6 +24,37 @@ auto constexpr modeNames = std::array{
 static_assert(enumNameMappingsAreUnique(modeNames), "Duplicate entry in name map!");
 static_assert(enumNameMapHasAllEntries(modeNames, SteeringMode::NoMode), "Missing entry in name map!");
 
+namespace {
+
+/**
+ * Start an asynchronous operation and block until its completion handler was invoked
+ */
+template<typename ResultType, typename Operation>
+auto awaitCompletion(Operation &&operation) -> ResultType {
+	auto token = std::make_shared<std::promise<ResultType>>();
+	auto future = token->get_future();
+
+	if constexpr (std::is_void_v<ResultType>) {
+		operation(Actor::CompletionHandler<>{[token] { token->set_value(); }});
+	} else {
+		operation(Actor::CompletionHandler<ResultType>{[token](ResultType result) { token->set_value(result); }});
+	}
+
+	return future.get();
+}
+
+/**
+ * Replace an empty completion handler with one that simply discards the result
+ */
+template<typename... ResultTypes>
+auto orIgnore(Actor::CompletionHandler<ResultTypes...> handler) -> Actor::CompletionHandler<ResultTypes...> {
+	if (handler) {
+		return handler;
+	}
+	return [](ResultTypes...) {};
+}
+
+} // namespace
 
 auto isKnownSteeringMode(int candidate) -> bool {
 	return candidate >= static_cast<int>(SteeringMode::NoMode) &&
@@ -34,103 +68,142 @@ auto isKnownSteeringMode(std::string const &candidate) -> bool {
 }
 
 auto Actor::connect() -> bool {
-	auto token = std::promise<bool>{};
-	auto future = token.get_future();
-	doConnect(std::move(token));
-	return future.get();
+	return awaitCompletion<bool>([this](auto handler) { asyncConnect(std::move(handler)); });
 }
 
 auto Actor::disconnect() -> void {
-	auto token = std::promise<void>{};
-	auto future = token.get_future();
-	doDisconnect(std::move(token));
-	return future.get();
+	return awaitCompletion<void>([this](auto handler) { asyncDisconnect(std::move(handler)); });
 }
 
 auto Actor::takeControl() -> bool {
-	auto token = std::promise<bool>{};
-	auto future = token.get_future();
-	doTakeControl(std::move(token));
-	return future.get();
+	return awaitCompletion<bool>([this](auto handler) { asyncTakeControl(std::move(handler)); });
 }
 
 auto Actor::releaseControl() -> bool {
-	auto token = std::promise<bool>{};
-	auto future = token.get_future();
-	doReleaseControl(std::move(token));
-	return future.get();
+	return awaitCompletion<bool>([this](auto handler) { asyncReleaseControl(std::move(handler)); });
 }
 
 auto Actor::initialize() -> void {
-	auto token = std::promise<void>{};
-	auto future = token.get_future();
-	doInitialize(std::move(token));
-	return future.get();
+	return awaitCompletion<void>([this](auto handler) { asyncInitialize(std::move(handler)); });
 }
 
 auto Actor::stopMoving() -> bool {
-	auto token = std::promise<bool>{};
-	auto future = token.get_future();
-	doStopMoving(std::move(token));
-	return future.get();
+	return awaitCompletion<bool>([this](auto handler) { asyncStopMoving(std::move(handler)); });
 }
 
 auto Actor::home() -> void {
-	auto token = std::promise<void>{};
-	auto future = token.get_future();
-	doHome(std::move(token));
-	return future.get();
+	return awaitCompletion<void>([this](auto handler) { asyncHome(std::move(handler)); });
 }
 
 auto Actor::retract() -> void {
-	auto token = std::promise<void>{};
-	auto future = token.get_future();
-	doRetract(std::move(token));
-	return future.get();
+	return awaitCompletion<void>([this](auto handler) { asyncRetract(std::move(handler)); });
 }
 
 auto Actor::moveTo(Coordinates position) -> void {
-	auto token = std::promise<void>{};
-	auto future = token.get_future();
-	doMoveTo(std::move(position), std::move(token));
-	return future.get();
+	return awaitCompletion<void>([&](auto handler) { asyncMoveTo(position, std::move(handler)); });
+}
+
+auto Actor::appendTarget(Coordinates position) -> void {
+	return awaitCompletion<void>([&](auto handler) { asyncAppendTarget(position, std::move(handler)); });
 }
 
 auto Actor::setJoystick(int x, int y, int z) -> void {
-	auto token = std::promise<void>{};
-	auto future = token.get_future();
-	doSetJoystick(x, y, z, std::move(token));
-	return future.get();
+	return awaitCompletion<void>([&](auto handler) { asyncSetJoystick(x, y, z, std::move(handler)); });
 }
 
 auto Actor::setSteeringMode(SteeringMode mode) -> bool {
-	assert(isKnownSteeringMode(static_cast<int>(mode)));
-
-	auto token = std::promise<bool>{};
-	auto future = token.get_future();
-	doSetSteeringMode(mode, std::move(token));
-	return future.get();
+	return awaitCompletion<bool>([&](auto handler) { asyncSetSteeringMode(mode, std::move(handler)); });
 }
 
 auto Actor::hasFailed() const -> bool {
-	auto token = std::promise<bool>{};
-	auto future = token.get_future();
-	doHasFailed(std::move(token));
-	return future.get();
+	return awaitCompletion<bool>([this](auto handler) { asyncHasFailed(std::move(handler)); });
 }
 
 auto Actor::getPosition() const -> Coordinates {
-	auto token = std::promise<Coordinates>{};
-	auto future = token.get_future();
-	doGetPosition(std::move(token));
-	return future.get();
+	return awaitCompletion<Coordinates>([this](auto handler) { asyncGetPosition(std::move(handler)); });
 }
 
 auto Actor::getSteeringMode() const -> std::optional<SteeringMode> {
-	auto token = std::promise<std::optional<SteeringMode>>{};
-	auto future = token.get_future();
-	doGetSteeringMode(std::move(token));
-	return future.get();
+	return awaitCompletion<std::optional<SteeringMode>>(
+	    [this](auto handler) { asyncGetSteeringMode(std::move(handler)); });
+}
+
+auto Actor::getUpdateStatistics() const -> UpdateStatistics {
+	return awaitCompletion<UpdateStatistics>([this](auto handler) { asyncGetUpdateStatistics(std::move(handler)); });
+}
+
+auto Actor::getTransactionStatistics() const -> TransactionStatistics {
+	return awaitCompletion<TransactionStatistics>(
+	    [this](auto handler) { asyncGetTransactionStatistics(std::move(handler)); });
+}
+
+auto Actor::asyncConnect(CompletionHandler<bool> handler) -> void {
+	doConnect(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncDisconnect(CompletionHandler<> handler) -> void {
+	doDisconnect(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncTakeControl(CompletionHandler<bool> handler) -> void {
+	doTakeControl(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncReleaseControl(CompletionHandler<bool> handler) -> void {
+	doReleaseControl(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncInitialize(CompletionHandler<> handler) -> void {
+	doInitialize(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncStopMoving(CompletionHandler<bool> handler) -> void {
+	doStopMoving(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncHome(CompletionHandler<> handler) -> void {
+	doHome(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncRetract(CompletionHandler<> handler) -> void {
+	doRetract(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncMoveTo(Coordinates position, CompletionHandler<> handler) -> void {
+	doMoveTo(std::move(position), orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncAppendTarget(Coordinates position, CompletionHandler<> handler) -> void {
+	doAppendTarget(std::move(position), orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void {
+	doSetJoystick(x, y, z, orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void {
+	assert(isKnownSteeringMode(static_cast<int>(mode)));
+	doSetSteeringMode(mode, orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncHasFailed(CompletionHandler<bool> handler) const -> void {
+	doHasFailed(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncGetPosition(CompletionHandler<Coordinates> handler) const -> void {
+	doGetPosition(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void {
+	doGetSteeringMode(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void {
+	doGetUpdateStatistics(orIgnore(std::move(handler)));
+}
+
+auto Actor::asyncGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void {
+	doGetTransactionStatistics(orIgnore(std::move(handler)));
 }
 
 auto Actor::setShouldReconnectOnError(bool reconnect) -> void {
@@ -141,47 +214,40 @@ auto Actor::shouldReconnectOnError() -> bool {
 	return reconnectOnError;
 }
 
+auto Actor::setTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void {
+	doSetTelemetryRecorder(std::move(recorder));
+}
+
 auto Actor::subscribe(EventSubscriberPtr subscriber) -> bool {
-	return eventSubscribers.insert(subscriber).second;
+	return eventSubscribers.add(std::move(subscriber));
 }
 
 auto Actor::unsubscribe(EventSubscriberPtr subscriber) -> bool {
-	return static_cast<bool>(eventSubscribers.erase(subscriber));
+	return eventSubscribers.remove(subscriber);
 }
 
 auto Actor::firePositionReached(Coordinates point) -> void {
-	for_each(begin(eventSubscribers), end(eventSubscribers), [&](auto subscriber) {
-		subscriber->onPositionReached(*this, point);
-	});
+	eventSubscribers.forEach([&](auto &subscriber) { subscriber.onPositionReached(*this, point); });
 }
 
 auto Actor::fireHomeReached() -> void {
-	for_each(
-	    begin(eventSubscribers), end(eventSubscribers), [this](auto subscriber) { subscriber->onHomeReached(*this); });
+	eventSubscribers.forEach([this](auto &subscriber) { subscriber.onHomeReached(*this); });
 }
 
 auto Actor::fireRetractionPointReached() -> void {
-	for_each(begin(eventSubscribers), end(eventSubscribers), [this](auto subscriber) {
-		subscriber->onRetractionPointReached(*this);
-	});
+	eventSubscribers.forEach([this](auto &subscriber) { subscriber.onRetractionPointReached(*this); });
 }
 
 auto Actor::fireSteeringModeChanged(SteeringMode mode) -> void {
-	for_each(begin(eventSubscribers), end(eventSubscribers), [&](auto subscriber) {
-		subscriber->onSteeringModeChanged(*this, mode);
-	});
+	eventSubscribers.forEach([&](auto &subscriber) { subscriber.onSteeringModeChanged(*this, mode); });
 }
 
 auto Actor::fireReconnectedDueToError() -> void {
-	for_each(begin(eventSubscribers), end(eventSubscribers), [this](auto subscriber) {
-		subscriber->onReconnectedDueToError(*this);
-	});
+	eventSubscribers.forEach([this](auto &subscriber) { subscriber.onReconnectedDueToError(*this); });
 }
 
 auto Actor::fireInitializationFinished() -> void {
-	for_each(begin(eventSubscribers), end(eventSubscribers), [this](auto subscriber) {
-		subscriber->onInitializationFinished(*this);
-	});
+	eventSubscribers.forEach([this](auto &subscriber) { subscriber.onInitializationFinished(*this); });
 }
 
 } // namespace KinovaZED::Hw
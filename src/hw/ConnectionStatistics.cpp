@@ -0,0 +1,43 @@
+#include "hw/ConnectionStatistics.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace KinovaZED::Hw {
+
+auto ConnectionStatistics::recordAttempt(bool succeeded) noexcept -> void {
+	++attempts;
+	failedAttempts += static_cast<std::uint64_t>(!succeeded);
+}
+
+auto ConnectionStatistics::recordReconnect(std::chrono::nanoseconds downtime) noexcept -> void {
+	++reconnects;
+	lastDowntime = downtime;
+	worstDowntime = std::max(worstDowntime, downtime);
+	totalDowntime += downtime;
+}
+
+} // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::ConnectionStatistics const &statistics) -> std::string {
+	using namespace std::chrono;
+
+	auto millis = [](nanoseconds value) { return duration_cast<milliseconds>(value).count(); };
+
+	return fmt::format("reconnects: {}, attempts: {} ({} failed), downtime (last/worst/total): {}ms/{}ms/{}ms",
+	                   statistics.reconnects,
+	                   statistics.attempts,
+	                   statistics.failedAttempts,
+	                   millis(statistics.lastDowntime),
+	                   millis(statistics.worstDowntime),
+	                   millis(statistics.totalDowntime));
+}
+
+} // namespace KinovaZED
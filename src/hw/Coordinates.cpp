@@ -1,7 +1,16 @@
 #include "hw/Coordinates.h"
 
+#include "support/EnumUtils.h"
+#include "support/ToString.h"
+
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string>
+#include <utility>
+
 namespace KinovaZED::Hw {
 
 auto constexpr jsonKeyX = "X";
@@ -11,6 +20,14 @@ auto constexpr jsonKeyPitch = "pitch";
 auto constexpr jsonKeyYaw = "yaw";
 auto constexpr jsonKeyRoll = "roll";
 
+auto constexpr errorNames = std::array{
+    std::pair{CoordinateError::XOutOfRange, "x is outside of valid range [-0.8, 0.8]"},
+    std::pair{CoordinateError::YOutOfRange, "y is outside of valid range [-0.85, 0.85]"},
+    std::pair{CoordinateError::ZOutOfRange, "z is outside of valid range [?, 1.15]"},
+};
+
+static_assert(enumNameMappingsAreUnique(errorNames), "Duplicate entry in name map!");
+static_assert(enumNameMapHasAllEntries(errorNames, CoordinateError::XOutOfRange), "Missing entry in name map!");
 
 void to_json(nlohmann::json &j, Coordinates const &c) {
 	j = nlohmann::json{{jsonKeyX, c.x},
@@ -31,3 +48,14 @@ void from_json(nlohmann::json const &j, Coordinates &c) {
 }
 
 } // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::CoordinateError const &error) -> std::string {
+	auto found =
+	    std::find_if(cbegin(Hw::errorNames), cend(Hw::errorNames), [&](auto entry) { return entry.first == error; });
+	return found != cend(Hw::errorNames) ? found->second : "unknown coordinate error";
+}
+
+} // namespace KinovaZED
@@ -0,0 +1,130 @@
+#include "hw/CurrentMonitor.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+
+namespace KinovaZED::Hw {
+
+CurrentMonitor::CurrentMonitor()
+    : CurrentMonitor{Limits{}} {
+}
+
+CurrentMonitor::CurrentMonitor(Limits limits)
+    : limits{limits} {
+}
+
+auto CurrentMonitor::record(JointCurrents const &currents) noexcept -> Level {
+	samples[next] = currents;
+	next = (next + 1) % windowSize;
+	count = std::min(count + 1, windowSize);
+
+	updateStatistics();
+	return currentLevel = assess();
+}
+
+auto CurrentMonitor::reset() noexcept -> void {
+	count = 0;
+	next = 0;
+	means = recentMeans = variances = slopes = JointCurrents{};
+	currentLevel = Level::Normal;
+}
+
+auto CurrentMonitor::setLimits(Limits limits) noexcept -> void {
+	this->limits = limits;
+}
+
+auto CurrentMonitor::level() const noexcept -> Level {
+	return currentLevel;
+}
+
+auto CurrentMonitor::size() const noexcept -> std::size_t {
+	return count;
+}
+
+auto CurrentMonitor::mean() const noexcept -> JointCurrents const & {
+	return means;
+}
+
+auto CurrentMonitor::recentMean() const noexcept -> JointCurrents const & {
+	return recentMeans;
+}
+
+auto CurrentMonitor::variance() const noexcept -> JointCurrents const & {
+	return variances;
+}
+
+auto CurrentMonitor::slope() const noexcept -> JointCurrents const & {
+	return slopes;
+}
+
+auto CurrentMonitor::updateStatistics() noexcept -> void {
+	// All per-joint loops run over fixed-size arrays without branches, so that the compiler can vectorize them.
+	auto sums = JointCurrents{};
+	auto squareSums = JointCurrents{};
+	auto weightedSums = JointCurrents{};
+	auto recentSums = JointCurrents{};
+
+	auto const recent = std::min(std::max(limits.confirmationSamples, std::size_t{1}), count);
+	auto const oldest = (next + windowSize - count) % windowSize;
+
+	for (auto age = std::size_t{}; age < count; ++age) {
+		auto const &sample = samples[(oldest + age) % windowSize];
+		auto const position = static_cast<float>(age);
+		auto const isRecent = static_cast<float>(age >= count - recent);
+
+		for (auto joint = std::size_t{}; joint < jointCount; ++joint) {
+			sums[joint] += sample[joint];
+			squareSums[joint] += sample[joint] * sample[joint];
+			weightedSums[joint] += position * sample[joint];
+			recentSums[joint] += isRecent * sample[joint];
+		}
+	}
+
+	auto const n = static_cast<float>(count);
+	auto const positionSum = n * (n - 1) / 2;
+	auto const positionSquareSum = (n - 1) * n * (2 * n - 1) / 6;
+	auto const denominator = n * positionSquareSum - positionSum * positionSum;
+	auto const slopeScale = denominator > 0 ? 1 / denominator : 0.0f;
+
+	for (auto joint = std::size_t{}; joint < jointCount; ++joint) {
+		means[joint] = sums[joint] / n;
+		recentMeans[joint] = recentSums[joint] / static_cast<float>(recent);
+		variances[joint] = std::max(squareSums[joint] / n - means[joint] * means[joint], 0.0f);
+		slopes[joint] = (n * weightedSums[joint] - positionSum * sums[joint]) * slopeScale;
+	}
+}
+
+auto CurrentMonitor::assess() const noexcept -> Level {
+	auto exceeds = [](JointCurrents const &values, JointCurrents const &bounds) {
+		auto exceeded = false;
+		for (auto joint = std::size_t{}; joint < jointCount; ++joint) {
+			exceeded |= values[joint] > bounds[joint];
+		}
+		return exceeded;
+	};
+
+	auto total = [](JointCurrents const &values) { return std::accumulate(cbegin(values), cend(values), 0.0f); };
+
+	if (count >= limits.confirmationSamples &&
+	    (exceeds(recentMeans, limits.hard) || total(recentMeans) > limits.totalHard)) {
+		return Level::Hard;
+	}
+
+	// The fitted line passes through the mean at the center of the window, so we extrapolate from there.
+	auto predicted = JointCurrents{};
+	auto const distance = static_cast<float>(count - 1) / 2 + static_cast<float>(limits.predictionHorizon);
+	for (auto joint = std::size_t{}; joint < jointCount; ++joint) {
+		predicted[joint] = means[joint] + slopes[joint] * distance;
+	}
+
+	auto const hasTrend = count >= windowSize / 2;
+	if (exceeds(means, limits.soft) || total(means) > limits.totalSoft ||
+	    (hasTrend && exceeds(predicted, limits.hard))) {
+		return Level::Soft;
+	}
+
+	return Level::Normal;
+}
+
+} // namespace KinovaZED::Hw
@@ -1,11 +1,12 @@
 #include "hw/KinovaArm.h"
 
 #include "hw/Coordinates.h"
+#include "support/ExecutorPool.h"
 #include "support/Logging.h"
 
+#include <asio/dispatch.hpp>
 #include <asio/io_context.hpp>
 
-#include <future>
 
 using namespace std::chrono_literals;
 
@@ -16,16 +17,68 @@ constexpr auto rotationRange = 0.25;
 constexpr auto velocityRange = 0.000002;
 
 KinovaArm::KinovaArm(Logger logger)
-    : KinovaArm{std::nullopt, logger} {
+    : KinovaArm{nullptr, std::nullopt, logger} {
 }
 
 KinovaArm::KinovaArm(Coordinates homePosition, Logger logger)
-    : KinovaArm{std::optional{homePosition}, logger} {
+    : KinovaArm{nullptr, std::optional{homePosition}, logger} {
+}
+
+KinovaArm::KinovaArm(ExecutorPool &executor, Logger logger)
+    : KinovaArm{&executor, std::nullopt, logger} {
+}
+
+KinovaArm::KinovaArm(ExecutorPool &executor, Coordinates homePosition, Logger logger)
+    : KinovaArm{&executor, std::optional{homePosition}, logger} {
 }
 
 KinovaArm::~KinovaArm() {
 	disconnect();
-	ioRunner.get();
+	drain(actionStrand);
+	if (ownExecutor) {
+		ownExecutor->shutdown();
+	}
+}
+
+auto KinovaArm::setPollingPolicy(PollingPolicy policy) -> void {
+	asio::dispatch(actionStrand, [this, policy] {
+		logInfo("setPollingPolicy",
+		        "polling every {0}ms while active and every {1}ms while idle",
+		        policy.activePeriod.count(),
+		        policy.idlePeriod.count());
+		pollingPolicy = policy;
+	});
+}
+
+auto KinovaArm::setReconnectPolicy(ReconnectPolicy policy) -> void {
+	asio::dispatch(actionStrand, [this, policy] {
+		logInfo("setReconnectPolicy",
+		        "reconnecting with delays from {0}ms up to {1}ms",
+		        policy.initialDelay.count(),
+		        policy.maximumDelay.count());
+		reconnector.setPolicy(policy);
+	});
+}
+
+auto KinovaArm::setCurrentLimits(CurrentMonitor::Limits limits) -> void {
+	asio::dispatch(actionStrand, [this, limits] {
+		logInfo("setCurrentLimits",
+		        "limiting the total current to {0}A (soft) and {1}A (hard)",
+		        limits.totalSoft,
+		        limits.totalHard);
+		currentMonitor.setLimits(limits);
+	});
+}
+
+auto KinovaArm::setJoystickOutputPeriod(std::chrono::milliseconds period) -> void {
+	asio::dispatch(actionStrand, [this, period] {
+		logInfo("setJoystickOutputPeriod", "sending joystick input every {0}ms", period.count());
+		joystickOutputPeriod = period;
+	});
+}
+
+auto KinovaArm::getTelemetryHistory() const -> TelemetryHistory const & {
+	return telemetryHistory;
 }
 
 } // namespace KinovaZED::Hw
\ No newline at end of file
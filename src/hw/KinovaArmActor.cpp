@@ -4,80 +4,87 @@
 #include <asio/post.hpp>
 
 #include <algorithm>
-#include <future>
+#include <memory>
 #include <optional>
+#include <utility>
 
 using namespace std::chrono_literals;
 
 namespace KinovaZED::Hw {
 
-constexpr auto joystickCalcFactor = 0.0025f;
-
-auto KinovaArm::doConnect(std::promise<bool> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doConnect(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
+		stopReconnecting();
 		try {
-			arm.emplace();
+			updateStatistics = UpdateStatistics{};
+			transactionStatistics = TransactionStatistics{};
+			openConnection();
 			logInfo("connect", "successfully connected to arm.");
-			state = VolatileState{};
-			performStateUpdate();
-			scheduleStateUpdate();
-			token.set_value(true);
+			handler(true);
 		} catch (std::exception const &e) {
 			logError("connect", "failed to connect to the arm. reason: {0}", e.what());
-			token.set_value(false);
+			if (shouldReconnectOnError()) {
+				startReconnecting();
+			}
+			handler(false);
 		}
 	});
 }
 
-auto KinovaArm::doDisconnect(std::promise<void> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doDisconnect(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
 		try {
+			stopReconnecting();
+			sequencer.cancel();
 			if (state->hasControl) {
 				releaseControl();
 			}
 			stateUpdateTimer.cancel();
-			ioWorkGuard.reset();
-			ioContext.stop();
+			joystickOutputTimer.cancel();
 			arm.reset();
 		} catch (std::exception const &e) {
 			logError("disconnect", "failed to close the connection to the arm. reason: {0}", e.what());
 		}
-		token.set_value();
+		handler();
 	});
 }
 
-auto KinovaArm::doTakeControl(std::promise<bool> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doTakeControl(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
+		expeditePolling();
 		try {
+			ensureConnected();
 			arm->start_api_ctrl();
 			state->hasControl = true;
 
-			if (!hasFailed()) {
+			if (!state->isInFailState) {
 				logInfo("takeControl", "gained control over the arm.");
 			}
 		} catch (std::exception const &e) {
 			logError("takeControl", "failed to take API control over the arm. reason: {0}", e.what());
 		}
-		token.set_value(!hasFailed());
+		handler(!state->isInFailState);
 	});
 }
 
-auto KinovaArm::doReleaseControl(std::promise<bool> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doReleaseControl(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
 		try {
+			ensureConnected();
 			arm->stop_api_ctrl();
 			logInfo("releaseControl", "released API control over the arm.");
 			state->hasControl = false;
-			token.set_value(true);
+			handler(true);
 		} catch (std::exception const &e) {
 			logError("releaseControl", "failed to release API control over the arm. reason: {0}", e.what());
-			token.set_value(false);
+			handler(false);
 		}
 	});
 }
 
-auto KinovaArm::doInitialize(std::promise<void> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doInitialize(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
+		expeditePolling();
 		try {
 			auto retractionMode = readRetractionMode();
 			state->movementStatus = MovementStatus::Initializing;
@@ -92,37 +99,43 @@ auto KinovaArm::doInitialize(std::promise<void> token) -> void {
 		} catch (std::exception const &e) {
 			logError("initialize", "failed to initialize the arm. reason: {0}", e.what());
 		}
-		token.set_value();
+		sequencer.notify([handler](bool) { handler(); });
 	});
 }
 
-auto KinovaArm::doStopMoving(std::promise<bool> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
-		try {
-			eraseTrajectories();
-			logInfo("stopMoving", "erased all stored trajectories.");
-		} catch (std::exception const &e) {
-			logError("stopMoving", "failed to erase stored trajectories. reason: {0}", e.what());
-		}
-
-		auto joystickPosition = KinDrv::jaco_joystick_axis_t{{0, 0, 0, 0, 0, 0}};
+auto KinovaArm::doStopMoving(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
+		expeditePolling();
 
-		try {
-			moveJoystick(joystickPosition);
-			logInfo("stopMoving", "successfully put the joystick into the neutral position.");
-			releaseJoystick();
-			logInfo("stopMoving", "successfully released the joystick.");
-			state->movementStatus.reset();
-			token.set_value(true);
-		} catch (std::exception const &e) {
-			logError("stop moving", "failed to release the joystick in the neutral position. reason: {}", e.what());
-			token.set_value(false);
+		if (auto dropped = sequencer.cancel(); dropped > 0) {
+			logInfo("stopMoving", "aborted {0} pending steps.", dropped);
 		}
+		queuedTargets.clear();
+		pausedTargets.clear();
+		joystickMailbox.clear();
+
+		eraseTrajectories();
+		sequencer.notify([this](bool succeeded) {
+			if (succeeded) {
+				logInfo("stopMoving", "erased all stored trajectories.");
+			}
+		});
+
+		moveJoystick(KinDrv::jaco_joystick_axis_t{{0, 0, 0, 0, 0, 0}});
+		releaseJoystick();
+		sequencer.notify([this, handler](bool succeeded) {
+			if (succeeded) {
+				logInfo("stopMoving", "successfully released the joystick in the neutral position.");
+				state->movementStatus.reset();
+			}
+			handler(succeeded);
+		});
 	});
 }
 
-auto KinovaArm::doHome(std::promise<void> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doHome(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
+		expeditePolling();
 		if (homePosition) {
 			logInfo("home", "moving towards software home.");
 			state->movementStatus = MovementStatus::HomingToSoftwareHome;
@@ -132,117 +145,149 @@ auto KinovaArm::doHome(std::promise<void> token) -> void {
 			state->movementStatus = MovementStatus::HomingToHardwareHome;
 			moveToHardwareHome();
 		}
-		token.set_value();
+		sequencer.notify([handler](bool) { handler(); });
 	});
 }
 
-auto KinovaArm::doRetract(std::promise<void> token) -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
+auto KinovaArm::doRetract(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)]() mutable {
+		expeditePolling();
 		moveToRetractionPoint();
-		token.set_value();
+		sequencer.notify([handler](bool) { handler(); });
 	});
 }
 
-auto KinovaArm::doMoveTo(Coordinates position, std::promise<void> token) -> void {
-	asio::dispatch(actionStrand, [this, position, token = std::move(token)]() mutable {
-		if (state->fullCurrent > 3.5) {
-			logWarning("moveTo", "high motor current detected, skipping movement. current: {0}", state->fullCurrent);
-		}
+auto KinovaArm::doMoveTo(Coordinates position, CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, position, handler = std::move(handler)]() mutable {
+		expeditePolling();
+
+		sequencer.append("set target position", [this, position] {
+			if (state->isCurrentLimited) {
+				logWarning("moveTo", "joint currents are above their soft limits, deferring movement until recovery");
+				queuedTargets.clear();
+				pausedTargets = {position};
+				state->targetPosition.reset();
+				state->movementStatus = MovementStatus::PausedForCurrent;
+				return;
+			}
 
-		try {
 			float fingerPositions[3] = {.0f, .0f, .0f};
 			auto armPosition = static_cast<std::array<float, 6>>(position);
-			arm->set_target_cart(armPosition.data(), fingerPositions);
+			transact(Transaction::SetCartesianTarget,
+			         [&] { arm->set_target_cart(armPosition.data(), fingerPositions); });
 			state->movementStatus = MovementStatus::MovingToPosition;
 			state->targetPosition = position;
-		} catch (std::exception const &e) {
-			logError("moveTo", "failed to move to desired position. reason: {0}", e.what());
-		}
-		token.set_value();
+			queuedTargets.clear();
+		});
+		sequencer.notify([handler](bool) { handler(); });
 	});
 }
 
-auto KinovaArm::doSetJoystick(int x, int y, int z, std::promise<void> token) -> void {
-	asio::dispatch(actionStrand, [this, x, y, z, token = std::move(token)]() mutable {
-		auto speedX = -x * joystickCalcFactor;
-		auto speedY = -y * joystickCalcFactor;
-		auto speedZ = z * joystickCalcFactor;
-
-		auto rawPosition = KinDrv::jaco_joystick_axis_t{};
-		rawPosition.s.trans_lr = 0;
-		rawPosition.s.trans_fb = 0;
-		rawPosition.s.trans_rot = 0;
-		rawPosition.s.wrist_lr = 0;
-		rawPosition.s.wrist_fb = 0;
-		rawPosition.s.wrist_rot = 0;
-
-		auto steeringMode = state->steeringMode;
-
-		if (steeringMode == SteeringMode::XYZ || steeringMode == SteeringMode::Axis1to3) {
-			rawPosition.s.trans_lr = speedX;
-			rawPosition.s.trans_fb = speedY;
-			rawPosition.s.trans_rot = speedZ;
-		} else if (steeringMode == SteeringMode::Rotation || steeringMode == SteeringMode::Axis4to6) {
-			rawPosition.s.wrist_lr = speedX;
-			rawPosition.s.wrist_fb = speedY;
-			rawPosition.s.wrist_rot = speedZ;
-		}
+auto KinovaArm::doAppendTarget(Coordinates position, CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, position, handler = std::move(handler)]() mutable {
+		expeditePolling();
 
-		try {
-			arm->move_joystick_axis(rawPosition);
-			logDebug("setJoystick", "setting joystick input to (x = {0}, y = {1}, z = {2})", speedX, speedY, speedZ);
-		} catch (std::exception const &e) {
-			logError("setJoystick", "failed to set joystick speeds. reason: {0}", e.what());
-		}
+		sequencer.append("queue target position", [this, position] {
+			if (state->movementStatus == MovementStatus::PausedForCurrent) {
+				pausedTargets.push_back(position);
+				return;
+			}
+
+			float fingerPositions[3] = {.0f, .0f, .0f};
+			auto armPosition = static_cast<std::array<float, 6>>(position);
+			transact(Transaction::SetCartesianTarget,
+			         [&] { arm->set_target_cart(armPosition.data(), fingerPositions); });
+
+			if (state->movementStatus == MovementStatus::MovingToPosition && state->targetPosition) {
+				queuedTargets.push_back(position);
+				logDebug("appendTarget", "queued target position. targets ahead: {0}", queuedTargets.size());
+			} else {
+				state->movementStatus = MovementStatus::MovingToPosition;
+				state->targetPosition = position;
+			}
+		});
+		sequencer.notify([handler](bool) { handler(); });
+	});
+}
 
-		token.set_value();
+auto KinovaArm::doSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void {
+	auto coalesced = joystickMailbox.post({x, y, z});
+
+	asio::dispatch(actionStrand, [this, coalesced, handler = std::move(handler)]() mutable {
+		updateStatistics.recordJoystickUpdate(coalesced);
+		pollingStatistics.timing.recordJoystickUpdate(coalesced);
+		startJoystickOutput();
+		handler();
 	});
 }
 
-auto KinovaArm::doSetSteeringMode(SteeringMode mode, std::promise<bool> token) -> void {
-	asio::dispatch(actionStrand, [this, mode, token = std::move(token)]() mutable {
+auto KinovaArm::doSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, mode, handler = std::move(handler)]() mutable {
+		expeditePolling();
 		if (mode != SteeringMode::NoMode && !canChangeMode()) {
 			logWarning("setSteeringMode",
 			           "rejected steering mode change. reason: not enough time elapsed since last change");
-			token.set_value(false);
+			handler(false);
+			return;
 		}
 
-		try {
+		sequencer.append("set control mode", [this, mode] {
+			ensureConnected();
 			if (mode == SteeringMode::Axis1to3 || mode == SteeringMode::Axis4to6) {
 				arm->set_control_ang();
 			} else {
 				arm->set_control_cart();
 			}
-		} catch (std::exception const &e) {
-			logError("setSteeringMode", "failed to set steering mode. reason: {0}", e.what());
-			token.set_value(false);
-		}
-
+		});
 		releaseJoystick();
-		state->steeringMode = mode;
+		sequencer.notify([this, mode, handler](bool succeeded) {
+			if (!succeeded) {
+				handler(false);
+				return;
+			}
 
-		if (mode != SteeringMode::NoMode) {
-			state->lastSteeringModeChange = std::chrono::steady_clock::now();
-		} else {
-			asio::post(actionStrand, [this, mode] { fireSteeringModeChanged(mode); });
-		}
+			state->steeringMode = mode;
+			publishState();
+
+			if (mode != SteeringMode::NoMode) {
+				state->lastSteeringModeChange = std::chrono::steady_clock::now();
+			} else {
+				asio::post(actionStrand, [this, mode] { fireSteeringModeChanged(mode); });
+			}
 
-		token.set_value(true);
+			handler(true);
+		});
 	});
 }
 
-auto KinovaArm::doHasFailed(std::promise<bool> token) const -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable { token.set_value(state->isInFailState); });
+auto KinovaArm::doHasFailed(CompletionHandler<bool> handler) const -> void {
+	handler(publishedState.load().isInFailState);
+}
+
+auto KinovaArm::doGetPosition(CompletionHandler<Coordinates> handler) const -> void {
+	handler(publishedState.load().currentPosition.value_or(Coordinates{}));
+}
+
+auto KinovaArm::doGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void {
+	handler(publishedState.load().steeringMode);
 }
 
-auto KinovaArm::doGetPosition(std::promise<Coordinates> token) const -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable {
-		token.set_value(state->currentPosition.value_or(Coordinates{}));
+auto KinovaArm::doGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		auto statistics = updateStatistics;
+		statistics.period = pollingPeriod;
+		handler(statistics);
 	});
 }
 
-auto KinovaArm::doGetSteeringMode(std::promise<std::optional<SteeringMode>> token) const -> void {
-	asio::dispatch(actionStrand, [this, token = std::move(token)]() mutable { token.set_value(state->steeringMode); });
+auto KinovaArm::doGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] { handler(transactionStatistics); });
+}
+
+auto KinovaArm::doSetTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void {
+	asio::dispatch(actionStrand, [this, recorder = std::move(recorder)]() mutable {
+		telemetryRecorder = std::move(recorder);
+	});
 }
 
 } // namespace KinovaZED::Hw
\ No newline at end of file
@@ -1,54 +1,344 @@
 #include "hw/KinovaArm.h"
 
+#include "support/CpuTime.h"
+
 #include <asio/dispatch.hpp>
 #include <asio/post.hpp>
 
 #include <algorithm>
 #include <cassert>
-#include <future>
+#include <cstdint>
 #include <iterator>
-#include <thread>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 using namespace std::chrono_literals;
 
 namespace KinovaZED::Hw {
 
-KinovaArm::KinovaArm(std::optional<Coordinates> origin, Logger logger)
+constexpr auto joystickCalcFactor = 0.0025f;
+constexpr auto currentLimitedJoystickFactor = 0.5f;
+
+KinovaArm::KinovaArm(ExecutorPool *executor, std::optional<Coordinates> origin, Logger logger)
     : LoggingMixin{logger, "KinovaArm"}
-    , homePosition{origin}
-    , ioWorkGuard{asio::make_work_guard(ioContext)} {
-	ioRunner = std::async(std::launch::async, [this] { ioContext.run(); });
+    , ownExecutor{executor ? nullptr : std::make_unique<ExecutorPool>(1)}
+    , ioContext{(executor ? *executor : *ownExecutor).context()}
+    , sequencer{actionStrand,
+                [this](auto const &step, auto const &error) {
+	                logError("<sequencer>", "failed to {0}. reason: {1}", step, error.what());
+                }}
+    , homePosition{origin} {
 }
 
 auto KinovaArm::scheduleStateUpdate() -> void {
-	stateUpdateTimer.expires_from_now(10ms);
+	pollingPeriod = selectPollingPeriod();
+	updateDeadline += pollingPeriod;
+	stateUpdateTimer.expires_at(updateDeadline);
+	awaitStateUpdate();
+}
+
+auto KinovaArm::awaitStateUpdate() -> void {
 	stateUpdateTimer.async_wait([this](auto error) {
-		if (!error) {
-			scheduleStateUpdate();
-			performStateUpdate();
+		if (error || !arm) {
+			return;
+		}
+
+		// Deadlines are absolute, so a late tick does not shift the following ones. If we fell behind by whole
+		// periods, we drop those ticks instead of running a burst of back-to-back updates.
+		auto const lateness = std::chrono::steady_clock::now() - updateDeadline;
+		auto const skippedTicks = static_cast<std::uint64_t>(lateness / pollingPeriod);
+		updateDeadline += skippedTicks * pollingPeriod;
+
+		recordUpdateTick(lateness, skippedTicks);
+		scheduleStateUpdate();
+		performStateUpdate();
+
+		if (arm && state->isInFailState && shouldReconnectOnError()) {
+			startReconnecting();
 		}
 	});
 }
 
 auto KinovaArm::performStateUpdate() -> void {
-	updatePosition();
-	updateRetractionMode();
+	auto const wallStart = std::chrono::steady_clock::now();
+	auto const cpuStart = threadCpuTime();
+
+	readDueTelemetry();
+	if (!arm) {
+		return;
+	}
+
+	recordTelemetrySample();
 	if (state->lastSteeringModeChange) {
 		updateSteeringMode();
 	}
-	checkCurrents();
-	checkMovement();
-	reconnectOnError();
+	publishState();
+	recordPollingStatistics(std::chrono::steady_clock::now() - wallStart, threadCpuTime() - cpuStart);
 }
 
 auto KinovaArm::stopUpdateLoop() -> void {
 	stateUpdateTimer.cancel();
 }
 
+auto KinovaArm::selectPollingPeriod() const -> std::chrono::milliseconds {
+	auto const isBusy = state && (state->movementStatus || state->lastSteeringModeChange);
+	auto const recentlyCommanded = (std::chrono::steady_clock::now() - lastCommand) < pollingPolicy.commandHoldTime;
+	return isBusy || recentlyCommanded ? pollingPolicy.activePeriod : pollingPolicy.idlePeriod;
+}
+
+auto KinovaArm::expeditePolling() -> void {
+	lastCommand = std::chrono::steady_clock::now();
+
+	if (pollingPeriod <= pollingPolicy.activePeriod) {
+		return;
+	}
+
+	auto const previousDeadline = updateDeadline - pollingPeriod;
+	auto const expeditedDeadline =
+	    std::max(previousDeadline + pollingPolicy.activePeriod, std::chrono::steady_clock::now());
+
+	// Only restart the wait if we actually cancelled a pending one. Otherwise, either the update loop is not running,
+	// or the next update is already queued and will pick up the active period by itself.
+	if (stateUpdateTimer.expires_at(expeditedDeadline) > 0) {
+		logDebug("expeditePolling", "switching to active polling period of {0}ms", pollingPolicy.activePeriod.count());
+		pollingPeriod = pollingPolicy.activePeriod;
+		updateDeadline = expeditedDeadline;
+		awaitStateUpdate();
+	}
+}
+
+auto KinovaArm::resetTelemetrySchedule() -> void {
+	for (auto &signal : telemetrySignals) {
+		signal.lastRead = {};
+	}
+}
+
+auto KinovaArm::readDueTelemetry() -> void {
+	auto const now = std::chrono::steady_clock::now();
+
+	for (auto reads = std::size_t{}; reads < pollingPolicy.maximumReadsPerUpdate; ++reads) {
+		auto mostOverdue = static_cast<TelemetrySignal *>(nullptr);
+		auto earliestRead = now;
+
+		for (auto &signal : telemetrySignals) {
+			auto nextRead = nextReadOf(signal);
+			if (nextRead && *nextRead <= now && (!mostOverdue || *nextRead < earliestRead)) {
+				mostOverdue = &signal;
+				earliestRead = *nextRead;
+			}
+		}
+
+		if (!mostOverdue) {
+			return;
+		}
+
+		mostOverdue->lastRead = now;
+		(this->*mostOverdue->read)();
+
+		// A read might have shut down the arm
+		if (!arm) {
+			return;
+		}
+	}
+}
+
+auto KinovaArm::nextReadOf(TelemetrySignal const &signal) const
+    -> std::optional<std::chrono::steady_clock::time_point> {
+	if (!signal.isActive || (this->*signal.isActive)()) {
+		return signal.lastRead + signal.activePeriod;
+	} else if (signal.idlePeriod.count() > 0) {
+		return signal.lastRead + signal.idlePeriod;
+	}
+	return std::nullopt;
+}
+
+auto KinovaArm::needsFastPositionUpdates() const -> bool {
+	return !state->currentPosition || state->movementStatus;
+}
+
+auto KinovaArm::needsRetractionModeUpdates() const -> bool {
+	return !state->retractionMode ||
+	    (state->movementStatus && state->movementStatus != MovementStatus::MovingToPosition &&
+	     state->movementStatus != MovementStatus::PausedForCurrent);
+}
+
+auto KinovaArm::needsMovementCheck() const -> bool {
+	return state->movementStatus == MovementStatus::MovingToPosition;
+}
+
+auto KinovaArm::recordUpdateTick(std::chrono::nanoseconds lateness, std::uint64_t skippedTicks) -> void {
+	updateStatistics.recordTick(lateness, skippedTicks);
+	pollingStatistics.timing.recordTick(lateness, skippedTicks);
+
+	if (skippedTicks) {
+		logWarning("<updateLoop>",
+		           "state update overran, skipped {0} ticks. lateness: {1}us",
+		           skippedTicks,
+		           std::chrono::duration_cast<std::chrono::microseconds>(lateness).count());
+	}
+}
+
+auto KinovaArm::recordPollingStatistics(std::chrono::nanoseconds wallTime, std::chrono::nanoseconds cpuTime)
+    -> void {
+	using namespace std::chrono;
+
+	updateStatistics.recordUpdate(wallTime);
+	pollingStatistics.timing.recordUpdate(wallTime);
+	pollingStatistics.activeUpdates += static_cast<std::size_t>(pollingPeriod <= pollingPolicy.activePeriod);
+	pollingStatistics.cpuTime += cpuTime;
+
+	auto const now = steady_clock::now();
+	auto const window = now - pollingStatistics.windowStart;
+	if (window < pollingPolicy.reportInterval) {
+		return;
+	}
+
+	auto const seconds = duration_cast<duration<double>>(window).count();
+	auto const updates = pollingStatistics.timing.updateDurations.count();
+	auto const cpuMicros = duration_cast<duration<double, std::micro>>(pollingStatistics.cpuTime).count();
+	pollingStatistics.timing.period = pollingPeriod;
+	logInfo("<pollingReport>",
+	        "effective polling rate: {0:.1f}Hz ({1} of {2} updates at the active rate), mean cpu time: {3:.0f}us per "
+	        "update, {4:.2f}% of one core, {5}",
+	        static_cast<double>(updates) / seconds,
+	        pollingStatistics.activeUpdates,
+	        updates,
+	        cpuMicros / static_cast<double>(updates),
+	        100.0 * duration_cast<duration<double>>(pollingStatistics.cpuTime).count() / seconds,
+	        toString(pollingStatistics.timing));
+	logInfo("<pollingReport>",
+	        "{0:.2f}% of the time spent in USB transactions: {1}",
+	        100.0 * duration_cast<duration<double>>(pollingStatistics.transactions.totalTime()).count() / seconds,
+	        toString(pollingStatistics.transactions));
+
+	pollingStatistics = PollingStatistics{now};
+}
+
+auto KinovaArm::recordTransaction(Transaction transaction, std::chrono::steady_clock::time_point start, bool failed)
+    -> void {
+	auto const duration = std::chrono::steady_clock::now() - start;
+	transactionStatistics.record(transaction, duration, failed);
+	pollingStatistics.transactions.record(transaction, duration, failed);
+}
+
+auto KinovaArm::startJoystickOutput() -> void {
+	if (isJoystickOutputActive) {
+		return;
+	}
+
+	isJoystickOutputActive = true;
+	joystickOutputTimer.expires_from_now(std::chrono::milliseconds{0});
+	emitJoystickOutput();
+}
+
+auto KinovaArm::emitJoystickOutput() -> void {
+	auto deflection = joystickMailbox.take();
+	if (!deflection) {
+		isJoystickOutputActive = false;
+		return;
+	}
+
+	expeditePolling();
+	auto const factor = joystickCalcFactor * (state->isCurrentLimited ? currentLimitedJoystickFactor : 1.0f);
+	auto speedX = -deflection->x * factor;
+	auto speedY = -deflection->y * factor;
+	auto speedZ = deflection->z * factor;
+
+	auto rawPosition = KinDrv::jaco_joystick_axis_t{};
+	rawPosition.s.trans_lr = 0;
+	rawPosition.s.trans_fb = 0;
+	rawPosition.s.trans_rot = 0;
+	rawPosition.s.wrist_lr = 0;
+	rawPosition.s.wrist_fb = 0;
+	rawPosition.s.wrist_rot = 0;
+
+	auto steeringMode = state->steeringMode;
+
+	if (steeringMode == SteeringMode::XYZ || steeringMode == SteeringMode::Axis1to3) {
+		rawPosition.s.trans_lr = speedX;
+		rawPosition.s.trans_fb = speedY;
+		rawPosition.s.trans_rot = speedZ;
+	} else if (steeringMode == SteeringMode::Rotation || steeringMode == SteeringMode::Axis4to6) {
+		rawPosition.s.wrist_lr = speedX;
+		rawPosition.s.wrist_fb = speedY;
+		rawPosition.s.wrist_rot = speedZ;
+	}
+
+	sequencer.append("set joystick speeds", [this, rawPosition, speedX, speedY, speedZ] {
+		transact(Transaction::MoveJoystickAxis, [&] { arm->move_joystick_axis(rawPosition); });
+		logDebug("setJoystick", "setting joystick input to (x = {0}, y = {1}, z = {2})", speedX, speedY, speedZ);
+	});
+
+	// Keep emitting at a fixed rate for as long as new input arrives, and go quiet once the mailbox stays empty.
+	auto const nextOutput = joystickOutputTimer.expiry() + joystickOutputPeriod;
+	joystickOutputTimer.expires_at(std::max(nextOutput, std::chrono::steady_clock::now()));
+	joystickOutputTimer.async_wait([this](auto error) {
+		if (error) {
+			isJoystickOutputActive = false;
+			return;
+		}
+		emitJoystickOutput();
+	});
+}
+
+auto KinovaArm::recordTelemetrySample() -> void {
+	if (!state->currentPosition) {
+		return;
+	}
+
+	telemetryHistory.push(TelemetrySample{
+	    std::chrono::steady_clock::now(), *state->currentPosition, state->jointCurrents, state->jointVelocities});
+
+	if (telemetryRecorder) {
+		auto const code = [](auto const &value) {
+			return value ? std::optional{static_cast<std::uint8_t>(*value)} : std::nullopt;
+		};
+		telemetryRecorder->record(TelemetryRecorder::Sample{
+		    *state->currentPosition,
+		    state->jointCurrents,
+		    code(state->retractionMode),
+		    code(state->movementStatus),
+		    state->hasControl,
+		    state->isInFailState,
+		    state->isCurrentLimited,
+		});
+	}
+}
+
+auto KinovaArm::dumpTelemetryHistory(std::chrono::seconds span) -> void {
+	using namespace std::chrono;
+
+	auto samples = std::vector<TelemetrySample>{};
+	samples.reserve(TelemetryHistory::capacity());
+
+	auto const now = steady_clock::now();
+	telemetryHistory.since(now - span, std::back_inserter(samples));
+
+	logInfo("<telemetryHistory>", "dumping {0} samples of the last {1}s", samples.size(), span.count());
+	for (auto const &sample : samples) {
+		auto const [x, y, z, pitch, yaw, roll] = static_cast<std::array<float, 6>>(sample.position);
+		logInfo("<telemetryHistory>",
+		        "t-{0}ms: position: ({1}, {2}, {3}, {4}, {5}, {6}), currents: ({7}), velocities: ({8})",
+		        duration_cast<milliseconds>(now - sample.timestamp).count(),
+		        x,
+		        y,
+		        z,
+		        pitch,
+		        yaw,
+		        roll,
+		        fmt::join(sample.jointCurrents, ", "),
+		        fmt::join(sample.jointVelocities, ", "));
+	}
+}
+
 auto KinovaArm::checkCurrents() -> void {
 	try {
-		auto rawCurrents = arm->get_ang_current();
+		auto rawCurrents = transact(Transaction::GetAngularCurrent, [&] { return arm->get_ang_current(); });
 		state->fullCurrent = std::accumulate(std::cbegin(rawCurrents.joints), std::cend(rawCurrents.joints), .0f);
+		std::copy(std::cbegin(rawCurrents.joints), std::cend(rawCurrents.joints), begin(state->jointCurrents));
 
 		if (state->fullCurrent > 2) {
 			logDebug("checkCurrents",
@@ -61,68 +351,176 @@ auto KinovaArm::checkCurrents() -> void {
 			         rawCurrents.joints[5]);
 		}
 
-		if (state->fullCurrent > 4.5f) {
-			logError("checkCurrents", "overcurrent detected. Shutting down the arm. current: {0}", state->fullCurrent);
-			disconnect();
-		}
+		handleCurrentLevel(currentMonitor.record(state->jointCurrents));
 	} catch (std::exception const &e) {
 		logError("updateCurrents", "failed to read currents from arm. reason: {0}", e.what());
 	}
 }
 
-auto KinovaArm::checkMovement() -> void {
-	auto velocities = arm->get_ang_vel();
-	auto isStopped = std::all_of(
-	    std::cbegin(velocities.joints), std::cend(velocities.joints), [](auto velocity) { return velocity == 0.0; });
+auto KinovaArm::handleCurrentLevel(CurrentMonitor::Level level) -> void {
+	switch (level) {
+	case CurrentMonitor::Level::Hard:
+		logError("checkCurrents",
+		         "sustained overcurrent detected. Shutting down the arm. recent currents: ({0})",
+		         fmt::join(currentMonitor.recentMean(), ", "));
+		dumpTelemetryHistory(std::chrono::seconds{2});
+		tripOvercurrentProtection();
+		break;
+	case CurrentMonitor::Level::Soft:
+		if (!state->isCurrentLimited) {
+			state->isCurrentLimited = true;
+			logWarning("checkCurrents",
+			           "joint currents approach their limits, slowing down. mean: ({0}), slope per sample: ({1})",
+			           fmt::join(currentMonitor.mean(), ", "),
+			           fmt::join(currentMonitor.slope(), ", "));
+			pauseMovement();
+		}
+		break;
+	case CurrentMonitor::Level::Normal:
+		if (state->isCurrentLimited) {
+			state->isCurrentLimited = false;
+			logInfo("checkCurrents", "joint currents recovered. mean: ({0})", fmt::join(currentMonitor.mean(), ", "));
+			resumeMovement();
+		}
+		break;
+	}
+}
+
+auto KinovaArm::tripOvercurrentProtection() -> void {
+	// We are in the middle of a state update on the strand, so we must not go through the blocking Actor interface.
+	// Once the arm is gone, the update loop stops reading from it and does not try to reconnect.
+	stopReconnecting();
+	if (state->hasControl) {
+		try {
+			arm->stop_api_ctrl();
+		} catch (std::exception const &e) {
+			logWarning("checkCurrents", "failed to release API control over the arm. reason: {0}", e.what());
+		}
+	}
+	closeConnection();
+}
 
-	if (!isStopped) {
+auto KinovaArm::pauseMovement() -> void {
+	if (state->movementStatus != MovementStatus::MovingToPosition) {
 		return;
 	}
 
-	if (state->movementStatus == MovementStatus::MovingToPosition && state->targetPosition) {
-		logWarning("checkMovement", "the arm stopped moving before reaching its target point!");
+	pausedTargets = std::exchange(queuedTargets, {});
+	if (state->targetPosition) {
+		pausedTargets.push_front(*state->targetPosition);
+	}
+	state->targetPosition.reset();
+	state->movementStatus = MovementStatus::PausedForCurrent;
+
+	logInfo("pauseMovement", "pausing movement with {0} targets left", pausedTargets.size());
+	eraseTrajectories();
+}
+
+auto KinovaArm::resumeMovement() -> void {
+	if (state->movementStatus != MovementStatus::PausedForCurrent) {
+		return;
+	}
+
+	state->movementStatus.reset();
+	auto targets = std::exchange(pausedTargets, {});
+
+	logInfo("resumeMovement", "resuming movement with {0} targets left", targets.size());
+	for (auto const &target : targets) {
+		asyncAppendTarget(target, {});
+	}
+}
+
+auto KinovaArm::checkMovement() -> void {
+	try {
+		auto velocities = transact(Transaction::GetAngularVelocity, [&] { return arm->get_ang_vel(); });
+		std::copy(std::cbegin(velocities.joints), std::cend(velocities.joints), begin(state->jointVelocities));
+		auto isStopped = std::all_of(std::cbegin(velocities.joints), std::cend(velocities.joints), [](auto velocity) {
+			return velocity == 0.0;
+		});
+
+		if (!isStopped) {
+			return;
+		}
+
+		if (state->movementStatus == MovementStatus::MovingToPosition && state->targetPosition) {
+			logWarning("checkMovement", "the arm stopped moving before reaching its target point!");
+		}
+	} catch (std::exception const &e) {
+		logWarning("<checkMovement>", "failed to read joint velocities from arm. reason: {0}", e.what());
 	}
 }
 
 auto KinovaArm::updatePosition() -> void {
 	try {
 		auto position = readPosition();
-		if (position == state->currentPosition) {
+		if (!position) {
+			logWarning("<updatePosition>", "arm reported an invalid position. reason: {0}", toString(position.error()));
+			return;
+		}
+
+		if (*position == state->currentPosition) {
 			return;
 		}
 
-		handlePosition(position);
-		state->currentPosition = position;
+		handlePosition(*position);
+		state->currentPosition = *position;
 	} catch (std::exception const &e) {
 		logWarning("<updatePosition>", "failed to read position from arm. reason: {0}", e.what());
 	}
 }
 
-auto KinovaArm::readPosition() -> Coordinates {
-	auto rawPosition = arm->get_cart_pos().s;
+auto KinovaArm::readPosition() -> Expected<Coordinates, CoordinateError> {
+	auto rawPosition = transact(Transaction::GetCartesianPosition, [&] { return arm->get_cart_pos(); }).s;
 
 	auto [x, y, z] = rawPosition.position;
 	auto [pitch, yaw, roll] = rawPosition.rotation;
 
-	return {x, y, z, pitch, yaw, roll};
+	return Coordinates::make(x, y, z, pitch, yaw, roll);
 }
 
 auto KinovaArm::handlePosition(Coordinates newPosition) -> void {
 	if (state->movementStatus == MovementStatus::HomingToSoftwareHome && newPosition == homePosition) {
 		state->retractionStatus = RetractionStatus::Homed;
 		state->movementStatus.reset();
-		std::this_thread::sleep_for(10ms);
-		asio::post(actionStrand, [this] { fireHomeReached(); });
+		sequencer.wait(10ms);
+		sequencer.notify([this](bool) { asio::post(actionStrand, [this] { fireHomeReached(); }); });
 		return;
 	}
 
-	if (state->movementStatus == MovementStatus::MovingToPosition && isInRange(newPosition, *state->targetPosition)) {
-		state->targetPosition.reset();
-		state->movementStatus.reset();
-		std::this_thread::sleep_for(10ms);
+	if (state->movementStatus != MovementStatus::MovingToPosition) {
+		return;
+	}
+
+	if (!isInRange(newPosition, *state->targetPosition)) {
+		// The arm may have passed through the current target in between two polls, and already reached a queued one
+		auto reached = findInRange(newPosition, cbegin(queuedTargets), cend(queuedTargets));
+		if (reached == cend(queuedTargets)) {
+			return;
+		}
+
+		auto passed = std::distance(cbegin(queuedTargets), reached) + 1;
+		logDebug("<handlePosition>", "passed {0} target(s) in between two polls", passed);
+		for (; passed > 0; --passed) {
+			state->targetPosition = queuedTargets.front();
+			queuedTargets.pop_front();
+			asio::post(actionStrand, [this, newPosition] { firePositionReached(newPosition); });
+		}
+	}
+
+	// The arm already follows the queued targets through its trajectory FIFO, so we only need to track progress
+	if (!queuedTargets.empty()) {
+		state->targetPosition = queuedTargets.front();
+		queuedTargets.pop_front();
 		asio::post(actionStrand, [this, newPosition] { firePositionReached(newPosition); });
 		return;
 	}
+
+	state->targetPosition.reset();
+	state->movementStatus.reset();
+	sequencer.wait(10ms);
+	sequencer.notify([this, newPosition](bool) {
+		asio::post(actionStrand, [this, newPosition] { firePositionReached(newPosition); });
+	});
 }
 
 auto KinovaArm::updateRetractionMode() -> void {
@@ -140,7 +538,7 @@ auto KinovaArm::updateRetractionMode() -> void {
 }
 
 auto KinovaArm::readRetractionMode() -> RetractionMode {
-	auto status = arm->get_status();
+	auto status = transact(Transaction::GetStatus, [&] { return arm->get_status(); });
 	return static_cast<RetractionMode>(status);
 }
 
@@ -196,64 +594,153 @@ auto KinovaArm::updateSteeringMode() -> void {
 	}
 }
 
-auto KinovaArm::reconnectOnError() -> void {
-	if (!(hasFailed() && shouldReconnectOnError())) {
+auto KinovaArm::openConnection() -> void {
+	state = VolatileState{};
+	currentMonitor.reset();
+	arm.emplace();
+	publishState();
+	resetTelemetrySchedule();
+	performStateUpdate();
+	ensureConnected();
+	updateDeadline = std::chrono::steady_clock::now();
+	scheduleStateUpdate();
+}
+
+auto KinovaArm::closeConnection() -> void {
+	sequencer.cancel();
+	queuedTargets.clear();
+	pausedTargets.clear();
+	joystickMailbox.clear();
+	stopUpdateLoop();
+	joystickOutputTimer.cancel();
+	arm.reset();
+
+	// While the arm is gone, all queries are answered from a snapshot that knows nothing about the arm
+	state = VolatileState{};
+	state->isInFailState = true;
+	publishState();
+}
+
+auto KinovaArm::ensureConnected() const -> void {
+	if (!arm) {
+		throw std::runtime_error{"the arm is not connected"};
+	}
+}
+
+auto KinovaArm::startReconnecting() -> void {
+	if (reconnector.isActive()) {
 		return;
 	}
 
-	auto hadControl = state->hasControl;
+	dumpTelemetryHistory(std::chrono::seconds{2});
+	auto const restoreControl = state->hasControl;
+	auto const restoreSteeringMode = state->steeringMode;
+	closeConnection();
+
+	logWarning("<reconnect>", "lost the connection to the arm after a critical error. trying to reconnect");
+	reconnector.start(
+	    [this, restoreControl, restoreSteeringMode] {
+		    try {
+			    openConnection();
+			    restoreConnectionState(restoreControl, restoreSteeringMode);
+		    } catch (...) {
+			    closeConnection();
+			    throw;
+		    }
+	    },
+	    [this](auto attempt, auto const &error) {
+		    logWarning("<reconnect>", "attempt {0} failed. reason: {1}", attempt, error.what());
+	    },
+	    [this](bool reconnected, auto attempts) {
+		    auto const &statistics = reconnector.getStatistics();
+		    if (!reconnected) {
+			    logError("<reconnect>", "giving up. {0}", toString(statistics));
+			    return;
+		    }
+
+		    logInfo("<reconnect>",
+		            "reconnected after {0} attempts and {1}ms. {2}",
+		            attempts,
+		            std::chrono::duration_cast<std::chrono::milliseconds>(statistics.lastDowntime).count(),
+		            toString(statistics));
+		    asio::post(actionStrand, [this] { fireReconnectedDueToError(); });
+	    });
+}
 
-	while (!connect()) {
-		logWarning("reconnectOnError", "Trying to reconnect after a critical error");
-		std::this_thread::sleep_for(50ms);
+auto KinovaArm::stopReconnecting() -> void {
+	if (reconnector.isActive()) {
+		logInfo("<reconnect>", "stopped reconnecting after {0} attempts", reconnector.stop());
 	}
+}
+
+auto KinovaArm::restoreConnectionState(bool restoreControl, std::optional<SteeringMode> restoreSteeringMode) -> void {
+	if (!restoreControl) {
+		return;
+	}
+
+	arm->start_api_ctrl();
+	state->hasControl = true;
 
-	if (hadControl) {
-		takeControl();
-		stopMoving();
+	if (auto mode = restoreSteeringMode) {
+		if (mode == SteeringMode::Axis1to3 || mode == SteeringMode::Axis4to6) {
+			arm->set_control_ang();
+		} else {
+			arm->set_control_cart();
+		}
+		state->steeringMode = mode;
 	}
 
-	asio::post(actionStrand, [this] { fireReconnectedDueToError(); });
+	publishState();
+	asyncStopMoving({});
+}
+
+auto KinovaArm::publishState() -> void {
+	if (state) {
+		publishedState.store(*state);
+	}
 }
 
 auto KinovaArm::moveToHardwareHome() -> void {
+	try {
+		state->retractionMode = readRetractionMode();
+	} catch (std::exception const &e) {
+		logError("moveToHardwareHome", "failed to read the retraction mode. reason: {0}", e.what());
+		return;
+	}
+
 	logDebug("moveToHardwareHome",
 	         "trying to move to hardware home. retraction mode: {0}",
 	         static_cast<int>(*state->retractionMode));
 
-	try {
-		switch (*state->retractionMode) {
-		case RetractionMode::RetractToReady:
-			pushButton(2);
-			// HACK: The arm does not realize we pressed the button if we don't wait longer than usual
-			std::this_thread::sleep_for(200ms);
-			releaseJoystick();
-			pushButton(2);
-			break;
-		case RetractionMode::NormalToReady:
-		case RetractionMode::ReadyToRetract:
-		case RetractionMode::RetractToStandby:
-		case RetractionMode::Normal:
-		case RetractionMode::NoInitToReady:
-			pushButton(2);
-			break;
-		case RetractionMode::Error:
-			logError("moveToHardwareHome", "arm is in a failure state.");
-			break;
-		default:
-			if (state->movementStatus == MovementStatus::HomingToHardwareHome) {
-				state->movementStatus.reset();
-				asio::post(actionStrand, [this] { fireHomeReached(); });
-			} else if (state->movementStatus == MovementStatus::Initializing) {
-				state->movementStatus.reset();
-				asio::post(actionStrand, [this] { fireInitializationFinished(); });
-			}
-			break;
+	switch (*state->retractionMode) {
+	case RetractionMode::RetractToReady:
+		pushButton(2);
+		// HACK: The arm does not realize we pressed the button if we don't wait longer than usual
+		sequencer.wait(200ms);
+		releaseJoystick();
+		pushButton(2);
+		break;
+	case RetractionMode::NormalToReady:
+	case RetractionMode::ReadyToRetract:
+	case RetractionMode::RetractToStandby:
+	case RetractionMode::Normal:
+	case RetractionMode::NoInitToReady:
+		pushButton(2);
+		break;
+	case RetractionMode::Error:
+		logError("moveToHardwareHome", "arm is in a failure state.");
+		break;
+	default:
+		if (state->movementStatus == MovementStatus::HomingToHardwareHome) {
+			state->movementStatus.reset();
+			asio::post(actionStrand, [this] { fireHomeReached(); });
+		} else if (state->movementStatus == MovementStatus::Initializing) {
+			state->movementStatus.reset();
+			asio::post(actionStrand, [this] { fireInitializationFinished(); });
 		}
-	} catch (std::exception const &e) {
-		logError("moveToHardwareHome", "failed to move to hardware home. reason: {0}", e.what());
+		break;
 	}
-} // namespace KinovaZED::Hw
+}
 
 auto KinovaArm::moveToSoftwareHome() -> void {
 	if (state->currentPosition == homePosition) {
@@ -261,7 +748,7 @@ auto KinovaArm::moveToSoftwareHome() -> void {
 		asio::post(actionStrand, [this] { fireHomeReached(); });
 		return;
 	} else if (state->wasHomed) {
-		moveTo(*homePosition);
+		asyncMoveTo(*homePosition, {});
 		return;
 	}
 
@@ -270,40 +757,42 @@ auto KinovaArm::moveToSoftwareHome() -> void {
 
 auto KinovaArm::moveToRetractionPoint() -> void {
 	state->movementStatus = MovementStatus::Retracting;
-	state->retractionMode = readRetractionMode();
-
 	try {
-		switch (*state->retractionMode) {
-		case RetractionMode::ReadyToRetract:
-			pushButton(2);
-			releaseJoystick();
-			pushButton(2);
-			break;
-		case RetractionMode::ReadyToStandby:
-		case RetractionMode::RetractToReady:
-			pushButton(2);
-			break;
-		case RetractionMode::NormalToReady:
-		case RetractionMode::Normal:
-		case RetractionMode::NoInitToReady:
-			logWarning("moveToRetractionPoint",
-			           "cannot retract from current mode. mode: {0}",
-			           static_cast<int>(*state->retractionMode));
-			state->movementStatus = MovementStatus::HomeToRetract;
-			pushButton(2);
-			break;
-		case RetractionMode::Error:
-			logError("moveToRetractionPoint", "arm is in a failure state.");
-			break;
-		default:
-			if (state->movementStatus == MovementStatus::Retracting) {
-				state->movementStatus.reset();
-				asio::post(actionStrand, [this] { fireRetractionPointReached(); });
-			}
-			break;
-		}
+		state->retractionMode = readRetractionMode();
 	} catch (std::exception const &e) {
-		logError("moveToRetractionPoint", "failed to retract the arm. reason: {0}", e.what());
+		logError("moveToRetractionPoint", "failed to read the retraction mode. reason: {0}", e.what());
+		state->movementStatus.reset();
+		return;
+	}
+
+	switch (*state->retractionMode) {
+	case RetractionMode::ReadyToRetract:
+		pushButton(2);
+		releaseJoystick();
+		pushButton(2);
+		break;
+	case RetractionMode::ReadyToStandby:
+	case RetractionMode::RetractToReady:
+		pushButton(2);
+		break;
+	case RetractionMode::NormalToReady:
+	case RetractionMode::Normal:
+	case RetractionMode::NoInitToReady:
+		logWarning("moveToRetractionPoint",
+		           "cannot retract from current mode. mode: {0}",
+		           static_cast<int>(*state->retractionMode));
+		state->movementStatus = MovementStatus::HomeToRetract;
+		pushButton(2);
+		break;
+	case RetractionMode::Error:
+		logError("moveToRetractionPoint", "arm is in a failure state.");
+		break;
+	default:
+		if (state->movementStatus == MovementStatus::Retracting) {
+			state->movementStatus.reset();
+			asio::post(actionStrand, [this] { fireRetractionPointReached(); });
+		}
+		break;
 	}
 }
 
@@ -314,27 +803,31 @@ auto KinovaArm::canChangeMode() -> bool {
 }
 
 auto KinovaArm::pushButton(int index) -> void {
-	logDebug("pushButton", "pushing button {0}", index);
-	arm->push_joystick_button(index);
-	std::this_thread::sleep_for(std::chrono::milliseconds{10});
+	sequencer.append("push button", [this, index] {
+		logDebug("pushButton", "pushing button {0}", index);
+		transact(Transaction::PushJoystickButton, [&] { arm->push_joystick_button(index); });
+	}, 10ms);
 }
 
 auto KinovaArm::releaseJoystick() -> void {
-	logDebug("releaseJoystick", "releasing joystick");
-	arm->release_joystick();
-	std::this_thread::sleep_for(std::chrono::milliseconds{10});
+	sequencer.append("release joystick", [this] {
+		logDebug("releaseJoystick", "releasing joystick");
+		transact(Transaction::ReleaseJoystick, [&] { arm->release_joystick(); });
+	}, 10ms);
 }
 
 auto KinovaArm::moveJoystick(KinDrv::jaco_joystick_axis_t position) -> void {
-	logDebug("moveJoystick", "moving joystick");
-	arm->move_joystick_axis(position);
-	std::this_thread::sleep_for(std::chrono::milliseconds{10});
+	sequencer.append("move joystick", [this, position] {
+		logDebug("moveJoystick", "moving joystick");
+		transact(Transaction::MoveJoystickAxis, [&] { arm->move_joystick_axis(position); });
+	}, 10ms);
 }
 
 auto KinovaArm::eraseTrajectories() -> void {
-	logDebug("eraseTrajectories", "erasing all trajectories");
-	arm->erase_trajectories();
-	std::this_thread::sleep_for(std::chrono::milliseconds{10});
+	sequencer.append("erase trajectories", [this] {
+		logDebug("eraseTrajectories", "erasing all trajectories");
+		transact(Transaction::EraseTrajectories, [&] { arm->erase_trajectories(); });
+	}, 10ms);
 }
 
-} // namespace KinovaZED::Hw
\ No newline at end of file
+} // namespace KinovaZED::Hw
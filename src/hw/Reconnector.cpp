@@ -0,0 +1,111 @@
+#include "hw/Reconnector.h"
+
+#include <asio/error.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace KinovaZED::Hw {
+
+auto ReconnectPolicy::delayFor(std::size_t attempts, std::minstd_rand &random) const -> std::chrono::milliseconds {
+	using namespace std::chrono;
+
+	auto const doublings = std::min<std::size_t>(attempts, 16);
+	auto const delay = std::min(initialDelay * (1 << doublings), maximumDelay);
+	auto const clampedJitter = std::clamp(jitter, 0.0, 1.0);
+	auto shortening = std::uniform_real_distribution<double>{1.0 - clampedJitter, 1.0};
+
+	return duration_cast<milliseconds>(delay * shortening(random));
+}
+
+Reconnector::Reconnector(asio::io_context::strand &strand)
+    : retryTimer{strand} {
+}
+
+auto Reconnector::setPolicy(ReconnectPolicy policy) -> void {
+	this->policy = policy;
+}
+
+auto Reconnector::start(Attempt attempt, FailureHandler failureHandler, Completion completion) -> bool {
+	if (pending) {
+		return false;
+	}
+
+	auto const lostAt = std::chrono::steady_clock::now();
+	pending = Pending{std::move(attempt), std::move(failureHandler), std::move(completion), lostAt};
+	scheduleAttempt();
+	return true;
+}
+
+auto Reconnector::stop() -> std::size_t {
+	if (!pending) {
+		return 0;
+	}
+
+	++generation;
+	auto ignored = asio::error_code{};
+	retryTimer.cancel(ignored);
+	return std::exchange(pending, std::nullopt)->attempts;
+}
+
+auto Reconnector::isActive() const -> bool {
+	return pending.has_value();
+}
+
+auto Reconnector::getStatistics() const -> ConnectionStatistics const & {
+	return statistics;
+}
+
+auto Reconnector::scheduleAttempt() -> void {
+	retryTimer.expires_from_now(policy.delayFor(pending->attempts, random));
+	retryTimer.async_wait([this, generation = generation](auto error) {
+		if (error || generation != this->generation || !pending) {
+			return;
+		}
+		runAttempt();
+	});
+}
+
+auto Reconnector::runAttempt() -> void {
+	auto const attempts = ++pending->attempts;
+	auto const generation = this->generation;
+
+	try {
+		pending->attempt();
+	} catch (std::exception const &error) {
+		statistics.recordAttempt(false);
+		if (pending->failureHandler) {
+			pending->failureHandler(attempts, error);
+		}
+
+		// The failure handler might have stopped us
+		if (generation != this->generation) {
+			return;
+		}
+
+		if (policy.maximumAttempts && attempts >= policy.maximumAttempts) {
+			auto completion = std::exchange(pending, std::nullopt)->completion;
+			if (completion) {
+				completion(false, attempts);
+			}
+			return;
+		}
+
+		scheduleAttempt();
+		return;
+	}
+
+	if (generation != this->generation) {
+		return;
+	}
+
+	statistics.recordAttempt(true);
+	statistics.recordReconnect(std::chrono::steady_clock::now() - pending->lostAt);
+
+	auto completion = std::exchange(pending, std::nullopt)->completion;
+	if (completion) {
+		completion(true, attempts);
+	}
+}
+
+} // namespace KinovaZED::Hw
@@ -0,0 +1,555 @@
+#include "hw/SimulatedArm.h"
+
+#include <asio/dispatch.hpp>
+#include <asio/post.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace KinovaZED::Hw {
+
+constexpr auto joystickCalcFactor = 0.0025f;
+
+SimulatedArm::SimulatedArm(Logger logger)
+    : SimulatedArm{nullptr, Model{}, logger} {
+}
+
+SimulatedArm::SimulatedArm(Model model, Logger logger)
+    : SimulatedArm{nullptr, model, logger} {
+}
+
+SimulatedArm::SimulatedArm(ExecutorPool &executor, Model model, Logger logger)
+    : SimulatedArm{&executor, model, logger} {
+}
+
+SimulatedArm::SimulatedArm(ExecutorPool *executor, Model model, Logger logger)
+    : LoggingMixin{logger, "SimulatedArm"}
+    , model{model}
+    , ownExecutor{executor ? nullptr : std::make_unique<ExecutorPool>(1)}
+    , ioContext{(executor ? *executor : *ownExecutor).context()} {
+}
+
+SimulatedArm::~SimulatedArm() {
+	disconnect();
+	drain(actionStrand);
+	if (ownExecutor) {
+		ownExecutor->shutdown();
+	}
+}
+
+auto SimulatedArm::setReconnectPolicy(ReconnectPolicy policy) -> void {
+	asio::dispatch(actionStrand, [this, policy] { reconnector.setPolicy(policy); });
+}
+
+auto SimulatedArm::setCurrentLimits(CurrentMonitor::Limits limits) -> void {
+	asio::dispatch(actionStrand, [this, limits] { currentMonitor.setLimits(limits); });
+}
+
+auto SimulatedArm::simulateJointCurrents(CurrentMonitor::JointCurrents currents) -> void {
+	asio::dispatch(actionStrand, [this, currents] { jointCurrents = currents; });
+}
+
+auto SimulatedArm::simulateConnectionLoss(std::size_t failingAttempts) -> void {
+	asio::dispatch(actionStrand, [this, failingAttempts] {
+		if (!isConnected) {
+			return;
+		}
+
+		logWarning("simulateConnectionLoss", "simulating a critical USB error");
+		failingConnects = failingAttempts;
+		if (shouldReconnectOnError()) {
+			startReconnecting();
+		} else {
+			closeConnection();
+		}
+	});
+}
+
+/// @section Actor Interface Implementation
+
+auto SimulatedArm::doConnect(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		stopReconnecting();
+		try {
+			statistics = UpdateStatistics{};
+			transactions = TransactionStatistics{};
+			openConnection();
+			logInfo("connect", "successfully connected to simulated arm.");
+			handler(true);
+		} catch (std::exception const &e) {
+			logWarning("connect", "failed to connect to the simulated arm. reason: {0}", e.what());
+			if (shouldReconnectOnError()) {
+				startReconnecting();
+			}
+			handler(false);
+		}
+	});
+}
+
+auto SimulatedArm::doDisconnect(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		stopReconnecting();
+		isConnected = false;
+		hasControl = false;
+		stepTimer.cancel();
+		handler();
+	});
+}
+
+auto SimulatedArm::doTakeControl(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		transact(model.latencies.control);
+		hasControl = true;
+		logInfo("takeControl", "gained control over the simulated arm.");
+		handler(true);
+	});
+}
+
+auto SimulatedArm::doReleaseControl(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		transact(model.latencies.control);
+		hasControl = false;
+		logInfo("releaseControl", "released control over the simulated arm.");
+		handler(true);
+	});
+}
+
+auto SimulatedArm::doInitialize(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		transact(Transaction::GetStatus, model.latencies.readStatus);
+		transact(Transaction::PushJoystickButton, model.latencies.pushButton);
+		startGoal(Goal::Initialize);
+		handler();
+	});
+}
+
+auto SimulatedArm::doStopMoving(CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		transact(Transaction::EraseTrajectories, model.latencies.eraseTrajectories);
+		transact(Transaction::MoveJoystickAxis, model.latencies.moveJoystick);
+		transact(Transaction::ReleaseJoystick, model.latencies.releaseJoystick);
+
+		goal.reset();
+		target.reset();
+		queuedTargets.clear();
+		joystick = {};
+		handler(true);
+	});
+}
+
+auto SimulatedArm::doHome(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		transact(Transaction::PushJoystickButton, model.latencies.pushButton);
+		startGoal(Goal::Home);
+		handler();
+	});
+}
+
+auto SimulatedArm::doRetract(CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		transact(Transaction::GetStatus, model.latencies.readStatus);
+		transact(Transaction::PushJoystickButton, model.latencies.pushButton);
+		startGoal(Goal::Retract);
+		handler();
+	});
+}
+
+auto SimulatedArm::doMoveTo(Coordinates position, CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, position, handler = std::move(handler)] {
+		transact(Transaction::SetCartesianTarget, model.latencies.setTarget);
+		goal.reset();
+		queuedTargets.clear();
+		target = position;
+		targetReported = false;
+		handler();
+	});
+}
+
+auto SimulatedArm::doAppendTarget(Coordinates position, CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, position, handler = std::move(handler)] {
+		transact(Transaction::SetCartesianTarget, model.latencies.setTarget);
+		if (target && !targetReported) {
+			queuedTargets.push_back(position);
+		} else {
+			goal.reset();
+			target = position;
+			targetReported = false;
+		}
+		handler();
+	});
+}
+
+auto SimulatedArm::doSetJoystick(int x, int y, int z, CompletionHandler<> handler) -> void {
+	asio::dispatch(actionStrand, [this, x, y, z, handler = std::move(handler)] {
+		transact(Transaction::MoveJoystickAxis, model.latencies.moveJoystick);
+		joystick = {-x * joystickCalcFactor, -y * joystickCalcFactor, z * joystickCalcFactor};
+		statistics.recordJoystickUpdate(false);
+		handler();
+	});
+}
+
+auto SimulatedArm::doSetSteeringMode(SteeringMode mode, CompletionHandler<bool> handler) -> void {
+	asio::dispatch(actionStrand, [this, mode, handler = std::move(handler)] {
+		auto const now = std::chrono::steady_clock::now();
+		if (mode != SteeringMode::NoMode && lastSteeringModeChange &&
+		    now - *lastSteeringModeChange < model.steeringModeDelay) {
+			logWarning("setSteeringMode",
+			           "rejected steering mode change. reason: not enough time elapsed since last change");
+			handler(false);
+			return;
+		}
+
+		transact(model.latencies.control);
+		transact(Transaction::ReleaseJoystick, model.latencies.releaseJoystick);
+		steeringMode = mode;
+		joystick = {};
+
+		if (mode != SteeringMode::NoMode) {
+			lastSteeringModeChange = now;
+		} else {
+			asio::post(actionStrand, [this, mode] { fireSteeringModeChanged(mode); });
+		}
+
+		handler(true);
+	});
+}
+
+auto SimulatedArm::doHasFailed(CompletionHandler<bool> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] { handler(!isConnected); });
+}
+
+auto SimulatedArm::doGetPosition(CompletionHandler<Coordinates> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] { handler(position); });
+}
+
+auto SimulatedArm::doGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] { handler(steeringMode); });
+}
+
+auto SimulatedArm::doGetUpdateStatistics(CompletionHandler<UpdateStatistics> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] {
+		auto current = statistics;
+		current.period = model.stepPeriod;
+		handler(current);
+	});
+}
+
+auto SimulatedArm::doGetTransactionStatistics(CompletionHandler<TransactionStatistics> handler) const -> void {
+	asio::dispatch(actionStrand, [this, handler = std::move(handler)] { handler(transactions); });
+}
+
+auto SimulatedArm::doSetTelemetryRecorder(std::shared_ptr<TelemetryRecorder> recorder) -> void {
+	asio::dispatch(actionStrand, [this, recorder = std::move(recorder)]() mutable {
+		telemetryRecorder = std::move(recorder);
+	});
+}
+
+/// @section Simulation
+
+auto SimulatedArm::openConnection() -> void {
+	transact(model.latencies.connect);
+	if (failingConnects > 0) {
+		--failingConnects;
+		throw std::runtime_error{"simulated USB error"};
+	}
+
+	isConnected = true;
+	currentMonitor.reset();
+	stepDeadline = std::chrono::steady_clock::now();
+	scheduleStep();
+}
+
+auto SimulatedArm::closeConnection() -> void {
+	stepTimer.cancel();
+	isConnected = false;
+	hasControl = false;
+	goal.reset();
+	target.reset();
+	queuedTargets.clear();
+	joystick = {};
+
+	// Like the real arm, a freshly connected arm knows nothing about the previous steering mode
+	steeringMode.reset();
+	lastSteeringModeChange.reset();
+}
+
+auto SimulatedArm::startReconnecting() -> void {
+	if (reconnector.isActive()) {
+		return;
+	}
+
+	auto const restoreControl = hasControl;
+	auto const restoreSteeringMode = steeringMode;
+	closeConnection();
+
+	logWarning("<reconnect>", "lost the connection to the simulated arm. trying to reconnect");
+	reconnector.start(
+	    [this, restoreControl, restoreSteeringMode] {
+		    openConnection();
+		    restoreConnectionState(restoreControl, restoreSteeringMode);
+	    },
+	    [this](auto attempt, auto const &error) {
+		    logWarning("<reconnect>", "attempt {0} failed. reason: {1}", attempt, error.what());
+	    },
+	    [this](bool reconnected, auto attempts) {
+		    if (!reconnected) {
+			    logError("<reconnect>", "giving up. {0}", toString(reconnector.getStatistics()));
+			    return;
+		    }
+
+		    logInfo("<reconnect>", "reconnected after {0} attempts", attempts);
+		    asio::post(actionStrand, [this] { fireReconnectedDueToError(); });
+	    });
+}
+
+auto SimulatedArm::stopReconnecting() -> void {
+	if (reconnector.isActive()) {
+		logInfo("<reconnect>", "stopped reconnecting after {0} attempts", reconnector.stop());
+	}
+}
+
+auto SimulatedArm::restoreConnectionState(bool restoreControl, std::optional<SteeringMode> restoreSteeringMode)
+    -> void {
+	if (!restoreControl) {
+		return;
+	}
+
+	transact(model.latencies.control);
+	hasControl = true;
+
+	if (restoreSteeringMode) {
+		transact(model.latencies.control);
+		steeringMode = restoreSteeringMode;
+	}
+}
+
+auto SimulatedArm::transact(std::chrono::microseconds latency) -> void {
+	// The real driver blocks the strand for the duration of every USB transaction, so we do the same.
+	if (latency.count() > 0) {
+		std::this_thread::sleep_for(latency);
+	}
+}
+
+auto SimulatedArm::transact(Transaction transaction, std::chrono::microseconds latency) -> void {
+	auto const start = std::chrono::steady_clock::now();
+	transact(latency);
+	transactions.record(transaction, std::chrono::steady_clock::now() - start, false);
+}
+
+auto SimulatedArm::scheduleStep() -> void {
+	stepDeadline += model.stepPeriod;
+	stepTimer.expires_at(stepDeadline);
+	stepTimer.async_wait([this](auto error) {
+		if (error) {
+			return;
+		}
+
+		auto const lateness = std::chrono::steady_clock::now() - stepDeadline;
+		auto const skippedSteps = static_cast<std::uint64_t>(lateness / model.stepPeriod);
+		stepDeadline += skippedSteps * model.stepPeriod;
+		statistics.recordTick(lateness, skippedSteps);
+		scheduleStep();
+
+		auto const start = std::chrono::steady_clock::now();
+		performStep(model.stepPeriod * (skippedSteps + 1));
+		recordTelemetry();
+		statistics.recordUpdate(std::chrono::steady_clock::now() - start);
+	});
+}
+
+auto SimulatedArm::performStep(std::chrono::duration<float> elapsed) -> void {
+	transact(Transaction::GetCartesianPosition, model.latencies.readPosition);
+	transact(Transaction::GetStatus, model.latencies.readStatus);
+	transact(Transaction::GetAngularCurrent, model.latencies.readCurrents);
+	if (!checkCurrents()) {
+		return;
+	}
+
+	if (target) {
+		transact(Transaction::GetAngularVelocity, model.latencies.readVelocities);
+	}
+
+	auto const now = std::chrono::steady_clock::now();
+	if (lastSteeringModeChange && now - *lastSteeringModeChange >= model.steeringModeDelay) {
+		finishSteeringModeChange();
+	}
+
+	if (goal) {
+		advanceGoal(elapsed);
+		return;
+	}
+
+	if (target) {
+		auto const arrived = moveTowards(*target, elapsed);
+		if (!targetReported && (arrived || isInRange(position, *target))) {
+			auto reached = position;
+			asio::post(actionStrand, [this, reached] { firePositionReached(reached); });
+
+			if (!queuedTargets.empty()) {
+				target = queuedTargets.front();
+				queuedTargets.pop_front();
+			} else {
+				targetReported = true;
+			}
+		}
+
+		if (arrived && targetReported) {
+			target.reset();
+		}
+		return;
+	}
+
+	moveWithJoystick(elapsed);
+}
+
+auto SimulatedArm::moveTowards(Coordinates const &destination, std::chrono::duration<float> elapsed) -> bool {
+	auto approach = [](float &current, float goal, float maximumStep) {
+		auto const distance = goal - current;
+		current = std::fabs(distance) <= maximumStep ? goal : current + std::copysign(maximumStep, distance);
+		return current == goal;
+	};
+
+	auto const dx = destination.x - position.x;
+	auto const dy = destination.y - position.y;
+	auto const dz = destination.z - position.z;
+	auto const distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+	auto const step = model.maximumSpeed * elapsed.count();
+	auto const fraction = distance > step ? step / distance : 1.0f;
+
+	auto arrived = approach(position.x, destination.x, std::fabs(dx) * fraction);
+	arrived &= approach(position.y, destination.y, std::fabs(dy) * fraction);
+	arrived &= approach(position.z, destination.z, std::fabs(dz) * fraction);
+
+	auto const angularStep = model.maximumAngularSpeed * elapsed.count();
+	arrived &= approach(position.pitch, destination.pitch, angularStep);
+	arrived &= approach(position.yaw, destination.yaw, angularStep);
+	arrived &= approach(position.roll, destination.roll, angularStep);
+
+	return arrived;
+}
+
+auto SimulatedArm::moveWithJoystick(std::chrono::duration<float> elapsed) -> void {
+	auto velocity = [&](float input, float maximum) {
+		return std::clamp(input, -1.0f, 1.0f) * maximum * elapsed.count();
+	};
+
+	if (steeringMode == SteeringMode::XYZ || steeringMode == SteeringMode::Axis1to3) {
+		position.x = std::clamp(position.x + velocity(joystick[0], model.maximumSpeed), -0.8f, 0.8f);
+		position.y = std::clamp(position.y + velocity(joystick[1], model.maximumSpeed), -0.85f, 0.85f);
+		position.z = std::min(position.z + velocity(joystick[2], model.maximumSpeed), 1.14f);
+	} else if (steeringMode == SteeringMode::Rotation || steeringMode == SteeringMode::Axis4to6) {
+		position.pitch += velocity(joystick[0], model.maximumAngularSpeed);
+		position.yaw += velocity(joystick[1], model.maximumAngularSpeed);
+		position.roll += velocity(joystick[2], model.maximumAngularSpeed);
+	}
+}
+
+auto SimulatedArm::startGoal(Goal newGoal) -> void {
+	target.reset();
+	queuedTargets.clear();
+	goal = newGoal;
+
+	switch (retractionMode) {
+	case RetractionMode::NoInitToReady:
+		break;
+	case RetractionMode::RetractToStandby:
+		retractionMode = newGoal == Goal::Retract ? RetractionMode::RetractToStandby : RetractionMode::RetractToReady;
+		break;
+	case RetractionMode::ReadyToStandby:
+		retractionMode = newGoal == Goal::Retract ? RetractionMode::ReadyToRetract : RetractionMode::ReadyToStandby;
+		break;
+	default:
+		retractionMode = RetractionMode::NormalToReady;
+		break;
+	}
+
+	logDebug("startGoal", "retraction mode is now {0}", static_cast<int>(retractionMode));
+}
+
+auto SimulatedArm::advanceGoal(std::chrono::duration<float> elapsed) -> void {
+	auto const isRetracting = retractionMode == RetractionMode::ReadyToRetract;
+	auto const destination = isRetracting ? model.retractionPoint : model.hardwareHome;
+
+	if (retractionMode != RetractionMode::RetractToStandby && !moveTowards(destination, elapsed)) {
+		return;
+	}
+
+	if (isRetracting || retractionMode == RetractionMode::RetractToStandby) {
+		retractionMode = RetractionMode::RetractToStandby;
+		goal.reset();
+		asio::post(actionStrand, [this] { fireRetractionPointReached(); });
+		return;
+	}
+
+	retractionMode = RetractionMode::ReadyToStandby;
+	switch (*goal) {
+	case Goal::Initialize:
+		goal.reset();
+		asio::post(actionStrand, [this] { fireInitializationFinished(); });
+		break;
+	case Goal::Home:
+		goal.reset();
+		asio::post(actionStrand, [this] { fireHomeReached(); });
+		break;
+	case Goal::Retract:
+		// Like the real arm, we need to be at home before we can retract
+		retractionMode = RetractionMode::ReadyToRetract;
+		break;
+	}
+}
+
+auto SimulatedArm::checkCurrents() -> bool {
+	if (currentMonitor.record(jointCurrents) != CurrentMonitor::Level::Hard) {
+		return true;
+	}
+
+	logError("checkCurrents",
+	         "sustained overcurrent detected. Shutting down the simulated arm. recent currents: ({0})",
+	         fmt::join(currentMonitor.recentMean(), ", "));
+	stopReconnecting();
+	closeConnection();
+	return false;
+}
+
+auto SimulatedArm::finishSteeringModeChange() -> void {
+	lastSteeringModeChange.reset();
+	if (steeringMode) {
+		asio::post(actionStrand, [this, mode = *steeringMode] { fireSteeringModeChanged(mode); });
+	}
+}
+
+auto SimulatedArm::recordTelemetry() -> void {
+	if (!telemetryRecorder) {
+		return;
+	}
+
+	// Report the same movement status codes as the real arm does
+	auto movementStatus = std::optional<std::uint8_t>{};
+	if (goal == Goal::Initialize) {
+		movementStatus = 5;
+	} else if (goal == Goal::Home) {
+		movementStatus = 0;
+	} else if (goal == Goal::Retract) {
+		movementStatus = 3;
+	} else if (target && !targetReported) {
+		movementStatus = 2;
+	}
+
+	telemetryRecorder->record(TelemetryRecorder::Sample{
+	    position,
+	    jointCurrents,
+	    static_cast<std::uint8_t>(retractionMode),
+	    movementStatus,
+	    hasControl,
+	    false,
+	    false,
+	});
+}
+
+} // namespace KinovaZED::Hw
@@ -0,0 +1,110 @@
+#include "hw/StepSequencer.h"
+
+#include <asio/error.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace KinovaZED::Hw {
+
+StepSequencer::StepSequencer(asio::io_context::strand &strand, FailureHandler failureHandler)
+    : settleTimer{strand}
+    , failureHandler{std::move(failureHandler)} {
+}
+
+auto StepSequencer::append(std::string name, Action action, std::chrono::milliseconds settleTime) -> void {
+	enqueue(Step{std::move(name), std::move(action), settleTime});
+}
+
+auto StepSequencer::wait(std::chrono::milliseconds duration) -> void {
+	enqueue(Step{"wait", [] {}, duration});
+}
+
+auto StepSequencer::notify(Completion completion) -> void {
+	enqueue(Marker{std::move(completion)});
+}
+
+auto StepSequencer::cancel() -> std::size_t {
+	auto dropped = std::exchange(pending, {});
+
+	++generation;
+	if (std::exchange(isSettling, false)) {
+		auto ignored = asio::error_code{};
+		settleTimer.cancel(ignored);
+	}
+	batchFailed = false;
+
+	auto droppedSteps = std::count_if(cbegin(dropped), cend(dropped), [](auto const &entry) {
+		return std::holds_alternative<Step>(entry);
+	});
+
+	std::for_each(begin(dropped), end(dropped), [](auto &entry) {
+		if (auto marker = std::get_if<Marker>(&entry); marker && marker->completion) {
+			marker->completion(false);
+		}
+	});
+
+	return static_cast<std::size_t>(droppedSteps);
+}
+
+auto StepSequencer::isIdle() const -> bool {
+	return pending.empty() && !isSettling;
+}
+
+auto StepSequencer::enqueue(std::variant<Step, Marker> entry) -> void {
+	pending.push_back(std::move(entry));
+	if (!isRunning && !isSettling) {
+		runPending();
+	}
+}
+
+auto StepSequencer::runPending() -> void {
+	isRunning = true;
+
+	while (!pending.empty()) {
+		auto entry = std::move(pending.front());
+		pending.pop_front();
+
+		if (auto marker = std::get_if<Marker>(&entry)) {
+			auto succeeded = !std::exchange(batchFailed, false);
+			if (marker->completion) {
+				marker->completion(succeeded);
+			}
+			continue;
+		}
+
+		auto &step = std::get<Step>(entry);
+		if (batchFailed) {
+			continue;
+		}
+
+		try {
+			step.action();
+		} catch (std::exception const &error) {
+			batchFailed = true;
+			if (failureHandler) {
+				failureHandler(step.name, error);
+			}
+			continue;
+		}
+
+		if (step.settleTime.count() > 0) {
+			isRunning = false;
+			isSettling = true;
+			settleTimer.expires_from_now(step.settleTime);
+			settleTimer.async_wait([this, generation = generation](auto error) {
+				if (error || generation != this->generation) {
+					return;
+				}
+				isSettling = false;
+				runPending();
+			});
+			return;
+		}
+	}
+
+	isRunning = false;
+}
+
+} // namespace KinovaZED::Hw
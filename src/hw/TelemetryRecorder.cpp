@@ -0,0 +1,202 @@
+#include "hw/TelemetryRecorder.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace KinovaZED::Hw {
+
+namespace {
+
+auto constexpr magic = std::array{'K', 'Z', 'E', 'D', 'T', 'L', 'M', '1'};
+auto constexpr fileVersion = std::uint32_t{1};
+
+/**
+ * The header at the start of every telemetry ring file
+ *
+ * The header is padded to a cache line, so that the records never share a line with it.
+ */
+struct FileHeader {
+	std::array<char, 8> magic;
+	std::uint32_t version;
+	std::uint32_t recordSize;
+	std::uint64_t capacity;
+	std::array<std::byte, 40> reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader>, "The telemetry file header must be trivially copyable!");
+static_assert(sizeof(FileHeader) == 64, "The on-disk telemetry header layout must not change!");
+
+auto makeHeader(std::size_t capacity) -> FileHeader {
+	return {magic, fileVersion, sizeof(TelemetryRecord), capacity, {}};
+}
+
+auto isCompatible(FileHeader const &header, std::size_t capacity) -> bool {
+	return header.magic == magic && header.version == fileVersion && header.recordSize == sizeof(TelemetryRecord) &&
+	       header.capacity == capacity;
+}
+
+auto isValid(TelemetryRecord const &record, std::size_t capacity, std::size_t slot) -> bool {
+	return record.sequence != 0 && record.sequence % capacity == slot && record.checksum == record.computeChecksum();
+}
+
+[[noreturn]] auto throwSystemError(std::string const &what) -> void {
+	throw std::system_error{errno, std::generic_category(), what};
+}
+
+} // namespace
+
+auto TelemetryRecord::computeChecksum() const noexcept -> std::uint32_t {
+	auto bytes = std::array<unsigned char, offsetof(TelemetryRecord, checksum)>{};
+	std::memcpy(bytes.data(), this, bytes.size());
+	auto hash = std::uint32_t{2166136261u};
+	for (auto byte : bytes) {
+		hash = (hash ^ byte) * 16777619u;
+	}
+	return hash;
+}
+
+TelemetryRecorder::TelemetryRecorder(std::filesystem::path path, std::size_t capacity)
+    : slots{std::max(capacity, std::size_t{1})}
+    , mappingSize{sizeof(FileHeader) + slots * sizeof(TelemetryRecord)} {
+	descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (descriptor < 0) {
+		throwSystemError("failed to open telemetry file '" + path.string() + "'");
+	}
+
+	auto header = FileHeader{};
+	auto const existing = ::pread(descriptor, &header, sizeof(header), 0);
+	auto const isReusable = existing == static_cast<ssize_t>(sizeof(header)) && isCompatible(header, slots);
+
+	if (!isReusable && ::ftruncate(descriptor, 0) < 0) {
+		::close(descriptor);
+		throwSystemError("failed to reset telemetry file '" + path.string() + "'");
+	}
+
+	if (::ftruncate(descriptor, static_cast<off_t>(mappingSize)) < 0) {
+		::close(descriptor);
+		throwSystemError("failed to resize telemetry file '" + path.string() + "'");
+	}
+
+	if (auto error = ::posix_fallocate(descriptor, 0, static_cast<off_t>(mappingSize)); error && error != EOPNOTSUPP) {
+		::close(descriptor);
+		errno = error;
+		throwSystemError("failed to preallocate telemetry file '" + path.string() + "'");
+	}
+
+	mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+	if (mapping == MAP_FAILED) {
+		::close(descriptor);
+		throwSystemError("failed to map telemetry file '" + path.string() + "'");
+	}
+
+	if (isReusable) {
+		for (auto index = std::size_t{}; index < slots; ++index) {
+			auto const &record = *slot(index);
+			if (isValid(record, slots, index)) {
+				sequence = std::max(sequence, record.sequence + 1);
+			}
+		}
+	} else {
+		header = makeHeader(slots);
+		std::memcpy(mapping, &header, sizeof(header));
+	}
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+	flush();
+	::munmap(mapping, mappingSize);
+	::close(descriptor);
+}
+
+auto TelemetryRecorder::record(Sample const &sample) noexcept -> void {
+	auto const now = std::chrono::system_clock::now().time_since_epoch();
+	auto record = TelemetryRecord{
+	    sequence,
+	    std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(),
+	    {sample.position.x,
+	     sample.position.y,
+	     sample.position.z,
+	     sample.position.pitch,
+	     sample.position.yaw,
+	     sample.position.roll},
+	    sample.jointCurrents,
+	    sample.retractionMode.value_or(TelemetryRecord::unknown),
+	    sample.movementStatus.value_or(TelemetryRecord::unknown),
+	    controllerState.load(std::memory_order_relaxed),
+	    static_cast<std::uint8_t>((sample.hasControl ? TelemetryRecord::HasControl : 0) |
+	                              (sample.hasFailed ? TelemetryRecord::HasFailed : 0) |
+	                              (sample.isCurrentLimited ? TelemetryRecord::IsCurrentLimited : 0)),
+	    0,
+	};
+	record.checksum = record.computeChecksum();
+	std::memcpy(slot(sequence), &record, sizeof(record));
+	++sequence;
+}
+
+auto TelemetryRecorder::setControllerState(std::uint8_t state) noexcept -> void {
+	controllerState.store(state, std::memory_order_relaxed);
+}
+
+auto TelemetryRecorder::flush() -> void {
+	::msync(mapping, mappingSize, MS_ASYNC);
+}
+
+auto TelemetryRecorder::capacity() const noexcept -> std::size_t {
+	return slots;
+}
+
+auto TelemetryRecorder::nextSequence() const noexcept -> std::uint64_t {
+	return sequence;
+}
+
+auto TelemetryRecorder::slot(std::uint64_t sequence) noexcept -> TelemetryRecord * {
+	auto records = static_cast<std::byte *>(mapping) + sizeof(FileHeader);
+	return reinterpret_cast<TelemetryRecord *>(records + (sequence % slots) * sizeof(TelemetryRecord));
+}
+
+auto readTelemetryFile(std::filesystem::path const &path) -> std::vector<TelemetryRecord> {
+	auto file = std::ifstream{path, std::ios::binary};
+	if (!file) {
+		throw std::runtime_error{"failed to open telemetry file '" + path.string() + "'"};
+	}
+
+	auto header = FileHeader{};
+	if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+	    !isCompatible(header, static_cast<std::size_t>(header.capacity)) || header.capacity == 0) {
+		throw std::runtime_error{"'" + path.string() + "' is not a telemetry file"};
+	}
+
+	auto records = std::vector<TelemetryRecord>{};
+	auto record = TelemetryRecord{};
+	for (auto index = std::size_t{}; index < header.capacity; ++index) {
+		if (!file.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+			break;
+		}
+		if (isValid(record, static_cast<std::size_t>(header.capacity), index)) {
+			records.push_back(record);
+		}
+	}
+
+	std::sort(begin(records), end(records), [](auto const &lhs, auto const &rhs) {
+		return lhs.sequence < rhs.sequence;
+	});
+	return records;
+}
+
+} // namespace KinovaZED::Hw
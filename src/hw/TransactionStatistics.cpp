@@ -0,0 +1,95 @@
+#include "hw/TransactionStatistics.h"
+
+#include "support/EnumUtils.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace KinovaZED::Hw {
+
+auto constexpr transactionNames = std::array{
+    std::pair{Transaction::GetCartesianPosition, "get_cart_pos"},
+    std::pair{Transaction::GetStatus, "get_status"},
+    std::pair{Transaction::GetAngularCurrent, "get_ang_current"},
+    std::pair{Transaction::GetAngularVelocity, "get_ang_vel"},
+    std::pair{Transaction::SetCartesianTarget, "set_target_cart"},
+    std::pair{Transaction::MoveJoystickAxis, "move_joystick_axis"},
+    std::pair{Transaction::PushJoystickButton, "push_joystick_button"},
+    std::pair{Transaction::ReleaseJoystick, "release_joystick"},
+    std::pair{Transaction::EraseTrajectories, "erase_trajectories"},
+};
+
+static_assert(enumNameMappingsAreUnique(transactionNames), "Duplicate entry in name map!");
+static_assert(enumNameMapHasAllEntries(transactionNames, Transaction::GetCartesianPosition),
+              "Missing entry in name map!");
+
+auto TransactionStatistics::record(Transaction transaction, std::chrono::nanoseconds duration, bool failed) noexcept
+    -> void {
+	auto &entry = counters[static_cast<std::size_t>(transaction)];
+	entry.latencies.record(duration);
+	entry.errors += static_cast<std::uint64_t>(failed);
+}
+
+auto TransactionStatistics::operator[](Transaction transaction) const noexcept -> Counters const & {
+	return counters[static_cast<std::size_t>(transaction)];
+}
+
+auto TransactionStatistics::totalTime() const noexcept -> std::chrono::nanoseconds {
+	auto total = std::chrono::nanoseconds{};
+	for (auto const &entry : counters) {
+		total += entry.latencies.mean() * static_cast<std::int64_t>(entry.latencies.count());
+	}
+	return total;
+}
+
+} // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+using namespace Hw;
+
+template<>
+auto toString(Transaction const &transaction) -> std::string {
+	auto found = std::find_if(cbegin(transactionNames), cend(transactionNames), [&](auto entry) {
+		return entry.first == transaction;
+	});
+	assert(found != cend(transactionNames));
+	return found->second;
+}
+
+template<>
+auto toString(TransactionStatistics const &statistics) -> std::string {
+	using namespace std::chrono;
+
+	auto micros = [](nanoseconds value) { return duration_cast<duration<double, std::micro>>(value).count(); };
+	auto summary = std::string{};
+
+	for (auto const &[transaction, name] : transactionNames) {
+		auto const &[latencies, errors] = statistics[transaction];
+		if (!latencies.count()) {
+			continue;
+		}
+
+		summary += fmt::format("{}{}: {} calls, {} errors, latency (mean/p50/p99/max): "
+		                       "{:.0f}us/{:.0f}us/{:.0f}us/{:.0f}us",
+		                       summary.empty() ? "" : "; ",
+		                       name,
+		                       latencies.count(),
+		                       errors,
+		                       micros(latencies.mean()),
+		                       micros(latencies.percentile(.5)),
+		                       micros(latencies.percentile(.99)),
+		                       micros(latencies.max()));
+	}
+
+	return summary.empty() ? "no transactions" : summary;
+}
+
+} // namespace KinovaZED
@@ -0,0 +1,59 @@
+#include "hw/UpdateStatistics.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace KinovaZED::Hw {
+
+auto UpdateStatistics::recordTick(std::chrono::nanoseconds lateness, std::uint64_t skipped) noexcept -> void {
+	++ticks;
+	skippedTicks += skipped;
+	worstLateness = std::max(worstLateness, lateness);
+	totalLateness += lateness;
+}
+
+auto UpdateStatistics::recordUpdate(std::chrono::nanoseconds duration) noexcept -> void {
+	updateDurations.record(duration);
+}
+
+auto UpdateStatistics::recordJoystickUpdate(bool coalesced) noexcept -> void {
+	++joystickUpdates;
+	coalescedJoystickUpdates += static_cast<std::uint64_t>(coalesced);
+}
+
+auto UpdateStatistics::averageLateness() const noexcept -> std::chrono::nanoseconds {
+	return ticks ? totalLateness / static_cast<std::int64_t>(ticks) : std::chrono::nanoseconds{};
+}
+
+} // namespace KinovaZED::Hw
+
+namespace KinovaZED {
+
+template<>
+auto toString(Hw::UpdateStatistics const &statistics) -> std::string {
+	using namespace std::chrono;
+
+	auto micros = [](nanoseconds value) { return duration_cast<duration<double, std::micro>>(value).count(); };
+	auto const &durations = statistics.updateDurations;
+
+	return fmt::format("period: {}ms, ticks: {}, skipped ticks: {}, lateness (mean/worst): {:.0f}us/{:.0f}us, "
+	                   "update duration (mean/p50/p99/max): {:.0f}us/{:.0f}us/{:.0f}us/{:.0f}us, "
+	                   "joystick updates: {} ({} coalesced)",
+	                   statistics.period.count(),
+	                   statistics.ticks,
+	                   statistics.skippedTicks,
+	                   micros(statistics.averageLateness()),
+	                   micros(statistics.worstLateness),
+	                   micros(durations.mean()),
+	                   micros(durations.percentile(.5)),
+	                   micros(durations.percentile(.99)),
+	                   micros(durations.max()),
+	                   statistics.joystickUpdates,
+	                   statistics.coalescedJoystickUpdates);
+}
+
+} // namespace KinovaZED
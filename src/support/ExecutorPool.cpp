@@ -0,0 +1,49 @@
+#include "support/ExecutorPool.h"
+
+#include <asio/post.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+
+namespace KinovaZED {
+
+ExecutorPool::ExecutorPool(std::size_t threads)
+    : workGuard{asio::make_work_guard(ioContext)} {
+	std::generate_n(back_inserter(runners), std::max(threads, std::size_t{1}), [this] {
+		return std::async(std::launch::async, [this] { ioContext.run(); });
+	});
+}
+
+ExecutorPool::~ExecutorPool() {
+	shutdown();
+}
+
+auto ExecutorPool::context() noexcept -> asio::io_context & {
+	return ioContext;
+}
+
+auto ExecutorPool::size() const noexcept -> std::size_t {
+	return runners.size();
+}
+
+auto ExecutorPool::shutdown() -> void {
+	workGuard.reset();
+	ioContext.stop();
+	for (auto &runner : runners) {
+		if (runner.valid()) {
+			runner.get();
+		}
+	}
+}
+
+auto drain(asio::io_context::strand &strand) -> void {
+	auto drained = std::promise<void>{};
+
+	// Cancelled operations hand their completion to the context first, and only then to the strand. Going through the
+	// context before entering the strand makes sure we queue up behind them.
+	asio::post(strand.context(), [&] { asio::post(strand, [&] { drained.set_value(); }); });
+	drained.get_future().wait();
+}
+
+} // namespace KinovaZED
@@ -7,13 +7,34 @@
 
 #include <algorithm>
 #include <any>
-#include <exception>
+#include <charconv>
+#include <cstddef>
 #include <iterator>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <utility>
 #include <vector>
 
 namespace KinovaZED {
 
+/**
+ * Parse a complete string as a number, without throwing on malformed input
+ */
+template<typename NumberType>
+auto parseNumber(std::string text) -> std::optional<NumberType> {
+	trim(text);
+
+	auto value = NumberType{};
+	auto const last = text.data() + text.size();
+	auto [end, error] = std::from_chars(text.data(), last, value);
+	if (error != std::errc{} || end != last) {
+		return std::nullopt;
+	}
+	return value;
+}
+
 auto checkParameterCount(Comm::Command::Id id, std::vector<std::any> parameters) -> bool {
 	using namespace Comm;
 
@@ -27,6 +48,8 @@ auto checkParameterCount(Comm::Command::Id id, std::vector<std::any> parameters)
 	case Command::Id::Unfreeze:
 	case Command::Id::GetAbsolutePosition:
 	case Command::Id::GetObjectivePosition:
+	case Command::Id::GetUpdateStatistics:
+	case Command::Id::GetTransactionStatistics:
 		if (!parameters.empty()) {
 			return false;
 		}
@@ -63,39 +86,39 @@ auto adjustParameterTypes(Comm::Command::Id id, std::vector<std::any> &parameter
 	case Command::Id::Unfreeze:
 	case Command::Id::GetAbsolutePosition:
 	case Command::Id::GetObjectivePosition:
+	case Command::Id::GetUpdateStatistics:
+	case Command::Id::GetTransactionStatistics:
 		return true;
 	case Command::Id::RunObjective:
-	case Command::Id::SetActiveObjective:
-		try {
-			auto objectiveName = std::any_cast<std::string>(parameters.at(0));
-			if (!Control::isKnownObjectiveId(objectiveName)) {
-				return false;
-			}
-			parameters.front() = fromString<Control::Objective::Id>(objectiveName);
-			return true;
-		} catch (std::exception const &) {
+	case Command::Id::SetActiveObjective: {
+		auto objectiveName = parameters.empty() ? nullptr : std::any_cast<std::string>(&parameters.front());
+		if (!objectiveName || !Control::isKnownObjectiveId(*objectiveName)) {
 			return false;
 		}
-	case Command::Id::SetJoystickMode:
-		try {
-			auto modeName = std::any_cast<std::string>(parameters.at(0));
-			if (!Hw::isKnownSteeringMode(modeName)) {
-				return false;
-			}
-			parameters.front() = fromString<Hw::SteeringMode>(modeName);
-			return true;
-		} catch (std::exception const &) {
+		parameters.front() = fromString<Control::Objective::Id>(*objectiveName);
+		return true;
+	}
+	case Command::Id::SetJoystickMode: {
+		auto modeName = parameters.empty() ? nullptr : std::any_cast<std::string>(&parameters.front());
+		if (!modeName || !Hw::isKnownSteeringMode(*modeName)) {
 			return false;
 		}
-	case Command::Id::MoveJoystick:
-		try {
-			transform(cbegin(parameters), cend(parameters), begin(parameters), [](auto raw) {
-				return stoi(std::any_cast<std::string>(raw));
-			});
-			return true;
-		} catch (std::exception const &) {
-			return false;
+		parameters.front() = fromString<Hw::SteeringMode>(*modeName);
+		return true;
+	}
+	case Command::Id::MoveJoystick: {
+		auto values = std::vector<std::any>{};
+		for (auto const &parameter : parameters) {
+			auto raw = std::any_cast<std::string>(&parameter);
+			auto value = raw ? parseNumber<int>(*raw) : std::nullopt;
+			if (!value) {
+				return false;
+			}
+			values.push_back(*value);
 		}
+		parameters = std::move(values);
+		return true;
+	}
 	case Command::Id::END_OF_ENUM:
 		return false;
 	}
@@ -103,6 +126,29 @@ auto adjustParameterTypes(Comm::Command::Id id, std::vector<std::any> &parameter
 	return false;
 }
 
+/**
+ * Split the arm index off the command name, if the name carries one
+ *
+ * @return false if the arm index is malformed
+ */
+auto extractArmIndex(std::string &name, std::optional<std::size_t> &arm) -> bool {
+	auto separator = name.find('@');
+	if (separator == std::string::npos) {
+		return true;
+	}
+
+	auto index = name.substr(separator + 1);
+	name.erase(separator);
+	trim(name);
+	trim(index);
+
+	if (index.empty() || index.front() == '-') {
+		return false;
+	}
+	arm = parseNumber<std::size_t>(index);
+	return arm.has_value();
+}
+
 auto lineCommandFactory(std::string data) -> std::optional<Comm::Command> {
 	using namespace Comm;
 
@@ -111,7 +157,8 @@ auto lineCommandFactory(std::string data) -> std::optional<Comm::Command> {
 	auto name = std::string{};
 	std::getline(dataStream, name, ':');
 	trim(name);
-	if (name.empty() || !Comm::isKnownCommandId(name)) {
+	auto arm = std::optional<std::size_t>{};
+	if (!extractArmIndex(name, arm) || name.empty() || !Comm::isKnownCommandId(name)) {
 		return std::nullopt;
 	}
 
@@ -131,7 +178,7 @@ auto lineCommandFactory(std::string data) -> std::optional<Comm::Command> {
 		return std::nullopt;
 	}
 
-	return Command{id, parameters};
+	return Command{id, parameters, arm};
 }
 
 } // namespace KinovaZED
\ No newline at end of file
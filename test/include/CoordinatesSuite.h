@@ -0,0 +1,8 @@
+#ifndef COORDINATESSUITE_H_
+#define COORDINATESSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_CoordinatesSuite();
+
+#endif /* COORDINATESSUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef CORECONTROLLERSUITE_H_
+#define CORECONTROLLERSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_CoreControllerSuite();
+
+#endif /* CORECONTROLLERSUITE_H_ */
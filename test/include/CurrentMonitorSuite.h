@@ -0,0 +1,8 @@
+#ifndef CURRENTMONITORSUITE_H_
+#define CURRENTMONITORSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_CurrentMonitorSuite();
+
+#endif /* CURRENTMONITORSUITE_H_ */
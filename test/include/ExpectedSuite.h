@@ -0,0 +1,8 @@
+#ifndef EXPECTEDSUITE_H_
+#define EXPECTEDSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_ExpectedSuite();
+
+#endif /* EXPECTEDSUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef HISTORYRINGSUITE_H_
+#define HISTORYRINGSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_HistoryRingSuite();
+
+#endif /* HISTORYRINGSUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef JOYSTICKMAILBOXSUITE_H_
+#define JOYSTICKMAILBOXSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_JoystickMailboxSuite();
+
+#endif /* JOYSTICKMAILBOXSUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef KERNELSUITE_H_
+#define KERNELSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_KernelSuite();
+
+#endif /* KERNELSUITE_H_ */
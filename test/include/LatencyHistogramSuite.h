@@ -0,0 +1,8 @@
+#ifndef LATENCYHISTOGRAMSUITE_H_
+#define LATENCYHISTOGRAMSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_LatencyHistogramSuite();
+
+#endif /* LATENCYHISTOGRAMSUITE_H_ */
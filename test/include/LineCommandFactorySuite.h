@@ -0,0 +1,8 @@
+#ifndef LINECOMMANDFACTORYSUITE_H_
+#define LINECOMMANDFACTORYSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_LineCommandFactorySuite();
+
+#endif /* LINECOMMANDFACTORYSUITE_H_ */
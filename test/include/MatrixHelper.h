@@ -1,33 +1,33 @@
 #ifndef TEST_MATRIXHELPER_H_
 #define TEST_MATRIXHELPER_H_
 
-#include "Matrix.h"
+#include "math/Matrix.h"
 
 #include <cute/cute.h>
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iterator>
+#include <ostream>
 #include <vector>
 
 constexpr float epsilon = 0.00001;
 
+template<std::size_t Rows, std::size_t Columns>
 struct MatrixComparisonWrapper {
-	explicit MatrixComparisonWrapper(f2d_vec_t data)
+	explicit MatrixComparisonWrapper(KinovaZED::Matrix<Rows, Columns> data)
 	    : data{data} {
 	}
-	f2d_vec_t data;
+	KinovaZED::Matrix<Rows, Columns> data;
 
 	bool operator==(MatrixComparisonWrapper const &other) const {
-		if (data.size() != other.data.size()) {
-			return false;
-		}
-		for (auto rowIndex = 0u; rowIndex < data.size(); rowIndex++) {
-			if (data[rowIndex].size() != other.data[rowIndex].size()) {
-				return false;
-			}
-			for (auto colIndex = 0u; colIndex < data[rowIndex].size(); colIndex++) {
+		for (auto rowIndex = 0u; rowIndex < Rows; rowIndex++) {
+			for (auto colIndex = 0u; colIndex < Columns; colIndex++) {
 				if (fabs(data[rowIndex][colIndex] - other.data[rowIndex][colIndex]) > epsilon) {
 					return false;
 				}
@@ -37,7 +37,8 @@ struct MatrixComparisonWrapper {
 	}
 };
 
-inline std::ostream &operator<<(std::ostream &out, MatrixComparisonWrapper const &matrix) {
+template<std::size_t Rows, std::size_t Columns>
+inline std::ostream &operator<<(std::ostream &out, MatrixComparisonWrapper<Rows, Columns> const &matrix) {
 	out << "Matrix {\n";
 	for (auto const &row : matrix.data) {
 		out << "\t{";
@@ -65,8 +66,11 @@ struct VectorComparisonWrapper {
 	}
 };
 
-inline void assertMatrixEqual(f2d_vec_t const &expected, f2d_vec_t const &actual) {
-	ASSERT_EQUAL(MatrixComparisonWrapper{expected}, MatrixComparisonWrapper{actual});
+template<std::size_t Rows, std::size_t Columns>
+void assertMatrixEqual(KinovaZED::Matrix<Rows, Columns> const &expected,
+                       KinovaZED::Matrix<Rows, Columns> const &actual) {
+	using Wrapper = MatrixComparisonWrapper<Rows, Columns>;
+	ASSERT_EQUAL(Wrapper{expected}, Wrapper{actual});
 }
 
 inline std::ostream &operator<<(std::ostream &out, VectorComparisonWrapper const &vector) {
@@ -86,4 +90,28 @@ void assertArrayEqual(std::array<float, N> const &expected, std::array<float, N>
 	ASSERT_EQUAL(VectorComparisonWrapper{expected}, VectorComparisonWrapper{actual});
 }
 
+/**
+ * The number of representable floats between the two values, with positive and negative zero being equal
+ */
+inline std::int64_t ulpDistance(float lhs, float rhs) {
+	auto const ordered = [](float value) {
+		std::int32_t bits{};
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits < 0 ? -static_cast<std::int64_t>(bits & 0x7fffffff) : static_cast<std::int64_t>(bits);
+	};
+	return std::llabs(ordered(lhs) - ordered(rhs));
+}
+
+template<std::size_t Rows, std::size_t Columns>
+std::int64_t maximumUlpDistance(KinovaZED::Matrix<Rows, Columns> const &lhs,
+                                KinovaZED::Matrix<Rows, Columns> const &rhs) {
+	std::int64_t maximum{};
+	for (auto rowIndex = 0u; rowIndex < Rows; rowIndex++) {
+		for (auto colIndex = 0u; colIndex < Columns; colIndex++) {
+			maximum = std::max(maximum, ulpDistance(lhs[rowIndex][colIndex], rhs[rowIndex][colIndex]));
+		}
+	}
+	return maximum;
+}
+
 #endif /* TEST_MATRIXHELPER_H_ */
@@ -0,0 +1,8 @@
+#ifndef OBJECTIVEMANAGERSUITE_H_
+#define OBJECTIVEMANAGERSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_ObjectiveManagerSuite();
+
+#endif /* OBJECTIVEMANAGERSUITE_H_ */
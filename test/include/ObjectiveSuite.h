@@ -0,0 +1,8 @@
+#ifndef OBJECTIVESUITE_H_
+#define OBJECTIVESUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_ObjectiveSuite();
+
+#endif /* OBJECTIVESUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef POSESUITE_H_
+#define POSESUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_PoseSuite();
+
+#endif /* POSESUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef PRECISIONSUITE_H_
+#define PRECISIONSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_PrecisionSuite();
+
+#endif /* PRECISIONSUITE_H_ */
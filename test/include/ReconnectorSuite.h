@@ -0,0 +1,8 @@
+#ifndef RECONNECTORSUITE_H_
+#define RECONNECTORSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_ReconnectorSuite();
+
+#endif /* RECONNECTORSUITE_H_ */
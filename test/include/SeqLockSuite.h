@@ -0,0 +1,8 @@
+#ifndef SEQLOCKSUITE_H_
+#define SEQLOCKSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_SeqLockSuite();
+
+#endif /* SEQLOCKSUITE_H_ */
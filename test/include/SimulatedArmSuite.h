@@ -0,0 +1,8 @@
+#ifndef SIMULATEDARMSUITE_H_
+#define SIMULATEDARMSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_SimulatedArmSuite();
+
+#endif /* SIMULATEDARMSUITE_H_ */
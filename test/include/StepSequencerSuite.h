@@ -0,0 +1,8 @@
+#ifndef STEPSEQUENCERSUITE_H_
+#define STEPSEQUENCERSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_StepSequencerSuite();
+
+#endif /* STEPSEQUENCERSUITE_H_ */
@@ -0,0 +1,8 @@
+#ifndef SUBSCRIBERLISTSUITE_H_
+#define SUBSCRIBERLISTSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_SubscriberListSuite();
+
+#endif /* SUBSCRIBERLISTSUITE_H_ */
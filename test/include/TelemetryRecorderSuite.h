@@ -0,0 +1,8 @@
+#ifndef TELEMETRYRECORDERSUITE_H_
+#define TELEMETRYRECORDERSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_TelemetryRecorderSuite();
+
+#endif /* TELEMETRYRECORDERSUITE_H_ */
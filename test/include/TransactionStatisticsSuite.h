@@ -0,0 +1,8 @@
+#ifndef TRANSACTIONSTATISTICSSUITE_H_
+#define TRANSACTIONSTATISTICSSUITE_H_
+
+#include <cute/cute_suite.h>
+
+extern cute::suite make_suite_TransactionStatisticsSuite();
+
+#endif /* TRANSACTIONSTATISTICSSUITE_H_ */
@@ -0,0 +1,135 @@
+#include "CoordinatesSuite.h"
+
+#include "hw/Coordinates.h"
+
+#include <cute/cute.h>
+
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+using KinovaZED::Hw::Coordinates;
+
+namespace {
+
+auto const reference = Coordinates{0.1f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f};
+
+} // namespace
+
+void testCoordinatesAreAlignedForVectorLoads() {
+	auto const coordinates = std::vector<Coordinates>(3);
+
+	for (auto const &entry : coordinates) {
+		ASSERT_EQUAL(0, reinterpret_cast<std::uintptr_t>(&entry) % 16);
+	}
+}
+
+void testCoordinatesWithTinyDifferencesAreEqual() {
+	auto const other = Coordinates{0.100001f, -0.4f, 0.5f, 1.5f, 1.0f, 0.200001f};
+
+	ASSERT_EQUAL(reference, other);
+}
+
+void testEveryValueTakesPartInEquality() {
+	for (auto index = std::size_t{}; index < 6; ++index) {
+		auto other = reference;
+		other[index] += 0.001f;
+		ASSERT_NOT_EQUAL_TO(reference, other);
+	}
+}
+
+void testIsZeroChecksAllValues() {
+	ASSERT(Coordinates{}.isZero());
+	ASSERT(!(Coordinates{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.01f}.isZero()));
+}
+
+void testRangeUsesSeparateToleranceForPositionAndRotation() {
+	ASSERT(isInRange(reference, Coordinates{0.14f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f}));
+	ASSERT(!isInRange(reference, Coordinates{0.16f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f}));
+	ASSERT(isInRange(reference, Coordinates{0.1f, -0.4f, 0.5f, 1.5f, 1.0f, 0.4f}));
+	ASSERT(!isInRange(reference, Coordinates{0.1f, -0.4f, 0.5f, 1.5f, 1.0f, 0.5f}));
+}
+
+void testCoordinatesCanBeAddedAndSubtracted() {
+	auto const offset = Coordinates{0.1f, 0.1f, -0.1f, 0.5f, -0.5f, 0.25f};
+
+	ASSERT_EQUAL((Coordinates{0.2f, -0.3f, 0.4f, 2.0f, 0.5f, 0.45f}), reference + offset);
+	ASSERT_EQUAL(reference, (reference + offset) - offset);
+	ASSERT((reference - reference).isZero());
+}
+
+void testDistanceOnlyConsidersThePosition() {
+	auto const other = Coordinates{0.4f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f};
+
+	ASSERT_EQUAL_DELTA(0.5f, distance(reference, other), 0.00001f);
+}
+
+void testFindInRangeReturnsTheFirstMatchingTarget() {
+	auto const targets = std::deque<Coordinates>{
+	    Coordinates{0.5f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f},
+	    Coordinates{0.12f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f},
+	    reference,
+	};
+
+	auto found = findInRange(reference, cbegin(targets), cend(targets));
+
+	ASSERT_EQUAL(1, std::distance(cbegin(targets), found));
+}
+
+void testFindInRangeReturnsTheEndIfNothingMatches() {
+	auto const targets = std::vector<Coordinates>{Coordinates{0.5f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f}};
+
+	ASSERT(findInRange(reference, cbegin(targets), cend(targets)) == cend(targets));
+}
+
+void testFindNearestReturnsTheClosestPosition() {
+	auto const targets = std::vector<Coordinates>{
+	    Coordinates{0.5f, -0.4f, 0.5f, 0.0f, 0.0f, 0.0f},
+	    Coordinates{0.1f, -0.3f, 0.5f, 0.0f, 0.0f, 0.0f},
+	    Coordinates{0.1f, -0.4f, 0.3f, 0.0f, 0.0f, 0.0f},
+	};
+
+	auto found = findNearest(reference, cbegin(targets), cend(targets));
+
+	ASSERT_EQUAL(1, std::distance(cbegin(targets), found));
+	ASSERT(findNearest(reference, cend(targets), cend(targets)) == cend(targets));
+}
+
+void testMakeReportsPositionsOutsideOfTheBox() {
+	auto const created = Coordinates::make(0.9f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f);
+
+	ASSERT(!created);
+	ASSERT_EQUAL(static_cast<int>(KinovaZED::Hw::CoordinateError::XOutOfRange), static_cast<int>(created.error()));
+	ASSERT_EQUAL("x is outside of valid range [-0.8, 0.8]", KinovaZED::toString(created.error()));
+}
+
+void testMakeCreatesValidCoordinates() {
+	auto const created = Coordinates::make(0.1f, -0.4f, 0.5f, 1.5f, 1.0f, 0.2f);
+
+	ASSERT(created.hasValue());
+	ASSERT_EQUAL(reference, *created);
+}
+
+void testConstructorStillThrowsOutsideOfTheBox() {
+	ASSERT_THROWS((Coordinates{0.0f, 0.0f, 1.2f, 0.0f, 0.0f, 0.0f}), std::invalid_argument);
+}
+
+cute::suite make_suite_CoordinatesSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testCoordinatesAreAlignedForVectorLoads));
+	s.push_back(CUTE(testCoordinatesWithTinyDifferencesAreEqual));
+	s.push_back(CUTE(testEveryValueTakesPartInEquality));
+	s.push_back(CUTE(testIsZeroChecksAllValues));
+	s.push_back(CUTE(testRangeUsesSeparateToleranceForPositionAndRotation));
+	s.push_back(CUTE(testCoordinatesCanBeAddedAndSubtracted));
+	s.push_back(CUTE(testDistanceOnlyConsidersThePosition));
+	s.push_back(CUTE(testFindInRangeReturnsTheFirstMatchingTarget));
+	s.push_back(CUTE(testFindInRangeReturnsTheEndIfNothingMatches));
+	s.push_back(CUTE(testFindNearestReturnsTheClosestPosition));
+	s.push_back(CUTE(testMakeReportsPositionsOutsideOfTheBox));
+	s.push_back(CUTE(testMakeCreatesValidCoordinates));
+	s.push_back(CUTE(testConstructorStillThrowsOutsideOfTheBox));
+	return s;
+}
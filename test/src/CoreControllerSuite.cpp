@@ -0,0 +1,476 @@
+#include "CoreControllerSuite.h"
+
+#include "comm/Command.h"
+#include "comm/CommandInterface.h"
+#include "comm/Heartbeat.h"
+#include "comm/Notification.h"
+#include "control/CoreController.h"
+#include "control/Objective.h"
+#include "control/ObjectiveManager.h"
+#include "hw/Actor.h"
+#include "hw/Coordinates.h"
+#include "support/Logging.h"
+
+#include <cute/cute.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using KinovaZED::Comm::Command;
+using KinovaZED::Comm::Notification;
+using KinovaZED::Control::CoreController;
+using KinovaZED::Control::Objective;
+using KinovaZED::Control::ObjectiveManager;
+using KinovaZED::Hw::Actor;
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::SteeringMode;
+
+namespace {
+
+auto const logger = KinovaZED::makeLogger({"CoreControllerSuite", {}, {}, {}});
+
+/**
+ * A command interface that delivers commands on demand and records all notifications
+ */
+struct FakeInterface : KinovaZED::Comm::CommandInterface {
+	FakeInterface()
+	    : CommandInterface{[](auto) { return std::nullopt; }} {
+	}
+
+	auto deliver(Command command) -> void {
+		notifySubscribers(command);
+	}
+
+	auto count(Notification::Id id) const -> std::size_t {
+		return std::count(cbegin(notifications), cend(notifications), id);
+	}
+
+	std::vector<Notification::Id> notifications{};
+	std::vector<std::size_t> notifiedArms{};
+
+  private:
+	auto doStart() -> void override {
+	}
+
+	auto doStop() -> void override {
+	}
+
+	auto doSend(Notification message) -> void override {
+		notifications.push_back(message.getId());
+		notifiedArms.push_back(message.getArm());
+	}
+
+	auto doSend(KinovaZED::Comm::Heartbeat) -> void override {
+	}
+};
+
+/**
+ * An actor that completes every operation immediately and records the movement requests it receives
+ */
+struct FakeArm : Actor {
+	/**
+	 * Complete the stops that are still pending
+	 */
+	auto finishStops() -> void {
+		for (auto &handler : std::exchange(pendingStops, {})) {
+			handler(true);
+		}
+	}
+
+	std::vector<std::string> calls{};
+	std::vector<Coordinates> targets{};
+	bool defersStops{};
+
+  private:
+	auto doConnect(CompletionHandler<bool> handler) -> void override {
+		handler(true);
+	}
+
+	auto doDisconnect(CompletionHandler<> handler) -> void override {
+		handler();
+	}
+
+	auto doTakeControl(CompletionHandler<bool> handler) -> void override {
+		handler(true);
+	}
+
+	auto doReleaseControl(CompletionHandler<bool> handler) -> void override {
+		handler(true);
+	}
+
+	auto doInitialize(CompletionHandler<> handler) -> void override {
+		handler();
+	}
+
+	auto doStopMoving(CompletionHandler<bool> handler) -> void override {
+		calls.push_back("stopMoving");
+		if (!defersStops) {
+			handler(true);
+			return;
+		}
+
+		// Like the step sequencer of the real arm, a new stop fails the pending ones before it is queued itself
+		for (auto &superseded : std::exchange(pendingStops, {})) {
+			superseded(false);
+		}
+		pendingStops.push_back(std::move(handler));
+	}
+
+	auto doHome(CompletionHandler<> handler) -> void override {
+		handler();
+	}
+
+	auto doRetract(CompletionHandler<> handler) -> void override {
+		handler();
+	}
+
+	auto doMoveTo(Coordinates position, CompletionHandler<> handler) -> void override {
+		calls.push_back("moveTo");
+		targets.push_back(position);
+		handler();
+	}
+
+	auto doAppendTarget(Coordinates position, CompletionHandler<> handler) -> void override {
+		calls.push_back("appendTarget");
+		targets.push_back(position);
+		handler();
+	}
+
+	auto doSetJoystick(int, int, int, CompletionHandler<> handler) -> void override {
+		handler();
+	}
+
+	auto doSetSteeringMode(SteeringMode, CompletionHandler<bool> handler) -> void override {
+		handler(true);
+	}
+
+	auto doHasFailed(CompletionHandler<bool> handler) const -> void override {
+		handler(false);
+	}
+
+	auto doGetPosition(CompletionHandler<Coordinates> handler) const -> void override {
+		handler(Coordinates{});
+	}
+
+	auto doGetSteeringMode(CompletionHandler<std::optional<SteeringMode>> handler) const -> void override {
+		handler(SteeringMode::NoMode);
+	}
+
+	auto doGetUpdateStatistics(CompletionHandler<KinovaZED::Hw::UpdateStatistics> handler) const -> void override {
+		handler({});
+	}
+
+	auto doGetTransactionStatistics(CompletionHandler<KinovaZED::Hw::TransactionStatistics> handler) const
+	    -> void override {
+		handler({});
+	}
+
+	auto doSetTelemetryRecorder(std::shared_ptr<KinovaZED::Hw::TelemetryRecorder>) -> void override {
+	}
+
+	std::vector<CompletionHandler<bool>> pendingStops{};
+};
+
+Coordinates const handleOrigin{0.120, -0.723, 0.551, 1.491, -0.066, 0.002};
+
+/**
+ * Create a manager holding the handle objective, optionally with a waypoint that lies far outside of the reachable box
+ */
+auto makeObjectives(std::size_t waypoints, std::optional<std::size_t> unreachable = std::nullopt) -> ObjectiveManager {
+	auto sequence = std::vector<Coordinates>{};
+	for (auto index = std::size_t{}; index < waypoints; ++index) {
+		sequence.push_back({-0.031f + 0.01f * index, 0.085, -0.175, -0.027, -0.028, 0.020});
+	}
+	if (unreachable) {
+		sequence[*unreachable].x = 2;
+	}
+	auto stream = std::istringstream{
+	    nlohmann::json::array({Objective{Objective::Id::Handle, handleOrigin, sequence, true, logger}}).dump()};
+	return ObjectiveManager{stream, logger};
+}
+
+/**
+ * A controller that drives a fake arm, and has already been initialized
+ */
+struct Fixture {
+	explicit Fixture(std::size_t waypoints,
+	                 std::size_t lookahead = 2,
+	                 std::optional<std::size_t> unreachable = std::nullopt)
+	    : objectives{makeObjectives(waypoints, unreachable)}
+	    , controller{KinovaZED::Control::makeCoreController(interface, arm, 0, objectives, logger)} {
+		controller->setWaypointLookahead(lookahead);
+		interface.deliver(Command{Command::Id::QuitEStop, {}});
+		interface.deliver(Command{Command::Id::Initialize, {}});
+		controller->onInitializationFinished(arm);
+		arm.calls.clear();
+		interface.notifications.clear();
+	}
+
+	auto runObjective() -> void {
+		interface.deliver(Command{Command::Id::RunObjective, {Objective::Id::Handle}});
+	}
+
+	auto reachWaypoints(std::size_t count) -> void {
+		for (auto index = std::size_t{}; index < count; ++index) {
+			controller->onPositionReached(arm, Coordinates{});
+		}
+	}
+
+	auto expectedTargets() -> std::vector<Coordinates> {
+		auto objective = objectives.getObjective(Objective::Id::Handle);
+		auto targets = std::vector<Coordinates>{};
+		for (auto point = objective.nextPoint(); point && *point; point = objective.nextPoint()) {
+			targets.push_back(**point);
+		}
+		return targets;
+	}
+
+	auto isRunningSequence() -> bool {
+		return controller->getSystemState().test(5);
+	}
+
+	FakeInterface interface{};
+	FakeArm arm{};
+	ObjectiveManager objectives;
+	std::shared_ptr<CoreController> controller;
+};
+
+using Calls = std::vector<std::string>;
+
+} // namespace
+
+void testRunObjectiveQueuesLookaheadBehindFirstWaypoint() {
+	auto fixture = Fixture{5};
+	fixture.runObjective();
+
+	ASSERT_EQUAL((Calls{"stopMoving", "moveTo", "appendTarget", "appendTarget"}), fixture.arm.calls);
+	auto const expected = fixture.expectedTargets();
+	ASSERT_EQUAL((std::vector<Coordinates>{cbegin(expected), std::next(cbegin(expected), 3)}), fixture.arm.targets);
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::Accepted));
+}
+
+void testReachedWaypointQueuesNextWaypointWithoutStopping() {
+	auto fixture = Fixture{5};
+	fixture.runObjective();
+	fixture.arm.calls.clear();
+
+	fixture.reachWaypoints(2);
+
+	ASSERT_EQUAL((Calls{"appendTarget", "appendTarget"}), fixture.arm.calls);
+	ASSERT_EQUAL(fixture.expectedTargets(), fixture.arm.targets);
+}
+
+void testObjectiveIsDoneOnlyOnceTheLastQueuedWaypointIsReached() {
+	auto fixture = Fixture{5};
+	fixture.runObjective();
+
+	fixture.reachWaypoints(4);
+	ASSERT_EQUAL(0, fixture.interface.count(Notification::Id::ObjectiveDone));
+	ASSERT(fixture.isRunningSequence());
+
+	fixture.reachWaypoints(1);
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::ObjectiveDone));
+	ASSERT(!fixture.isRunningSequence());
+}
+
+void testFinishingAnObjectiveDoesNotStopTheArm() {
+	auto fixture = Fixture{3};
+	fixture.runObjective();
+	fixture.arm.calls.clear();
+
+	fixture.reachWaypoints(3);
+
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::ObjectiveDone));
+	ASSERT_EQUAL(0, std::count(cbegin(fixture.arm.calls), cend(fixture.arm.calls), "stopMoving"));
+}
+
+void testObjectiveShorterThanLookaheadQueuesAllWaypoints() {
+	auto fixture = Fixture{2, 4};
+	fixture.runObjective();
+
+	ASSERT_EQUAL((Calls{"stopMoving", "moveTo", "appendTarget"}), fixture.arm.calls);
+
+	fixture.reachWaypoints(1);
+	ASSERT_EQUAL(0, fixture.interface.count(Notification::Id::ObjectiveDone));
+
+	fixture.reachWaypoints(1);
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::ObjectiveDone));
+}
+
+void testWithoutLookaheadEveryWaypointIsApproachedSeparately() {
+	auto fixture = Fixture{3, 0};
+	fixture.runObjective();
+	ASSERT_EQUAL((Calls{"stopMoving", "moveTo"}), fixture.arm.calls);
+
+	fixture.reachWaypoints(2);
+	ASSERT_EQUAL((Calls{"stopMoving", "moveTo", "stopMoving", "moveTo", "stopMoving", "moveTo"}), fixture.arm.calls);
+	ASSERT_EQUAL(fixture.expectedTargets(), fixture.arm.targets);
+	ASSERT_EQUAL(0, fixture.interface.count(Notification::Id::ObjectiveDone));
+
+	fixture.reachWaypoints(1);
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::ObjectiveDone));
+	ASSERT(!fixture.isRunningSequence());
+}
+
+void testEStopDuringPendingStopDoesNotStartTheObjective() {
+	auto fixture = Fixture{3};
+	fixture.arm.defersStops = true;
+	fixture.runObjective();
+
+	fixture.interface.deliver(Command{Command::Id::EStop, {}});
+	fixture.arm.finishStops();
+
+	ASSERT_EQUAL((Calls{"stopMoving", "stopMoving"}), fixture.arm.calls);
+	ASSERT(fixture.arm.targets.empty());
+}
+
+void testObjectiveDuringPendingStopOnlyStartsTheNewObjective() {
+	auto fixture = Fixture{3, 0};
+	fixture.arm.defersStops = true;
+	fixture.runObjective();
+
+	fixture.runObjective();
+	fixture.arm.finishStops();
+
+	ASSERT_EQUAL((Calls{"stopMoving", "stopMoving", "moveTo"}), fixture.arm.calls);
+}
+
+void testUnreachableWaypointAbortsTheObjectiveWithoutLookahead() {
+	auto fixture = Fixture{4, 0, 2};
+	fixture.runObjective();
+	fixture.reachWaypoints(1);
+	fixture.arm.calls.clear();
+
+	fixture.reachWaypoints(1);
+
+	ASSERT_EQUAL((Calls{"stopMoving"}), fixture.arm.calls);
+	ASSERT_EQUAL(fixture.expectedTargets(), fixture.arm.targets);
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::Rejected));
+	ASSERT_EQUAL(0, fixture.interface.count(Notification::Id::ObjectiveDone));
+	ASSERT(!fixture.isRunningSequence());
+}
+
+void testUnreachableWaypointAbortsTheObjectiveWithLookahead() {
+	auto fixture = Fixture{6, 2, 3};
+	fixture.runObjective();
+	fixture.arm.calls.clear();
+
+	fixture.reachWaypoints(1);
+
+	ASSERT_EQUAL((Calls{"stopMoving"}), fixture.arm.calls);
+	ASSERT_EQUAL(fixture.expectedTargets(), fixture.arm.targets);
+	ASSERT_EQUAL(1, fixture.interface.count(Notification::Id::Rejected));
+	ASSERT(!fixture.isRunningSequence());
+
+	fixture.reachWaypoints(2);
+
+	ASSERT_EQUAL((Calls{"stopMoving"}), fixture.arm.calls);
+	ASSERT_EQUAL(0, fixture.interface.count(Notification::Id::ObjectiveDone));
+}
+
+void testUnreachableWaypointWithinTheLookaheadRejectsTheObjective() {
+	auto fixture = Fixture{4, 2, 1};
+	fixture.runObjective();
+
+	ASSERT(fixture.arm.targets.empty());
+	ASSERT_EQUAL(std::vector<Notification::Id>{Notification::Id::Rejected}, fixture.interface.notifications);
+	ASSERT(!fixture.isRunningSequence());
+}
+
+void testReachedPositionOutsideOfSequenceIsIgnored() {
+	auto fixture = Fixture{3};
+	fixture.reachWaypoints(1);
+
+	ASSERT(fixture.arm.calls.empty());
+	ASSERT_EQUAL(0, fixture.interface.count(Notification::Id::ObjectiveDone));
+}
+
+/**
+ * Two controllers that each drive their own fake arm through the same interface
+ */
+struct TwoArmFixture {
+	TwoArmFixture()
+	    : objectives{makeObjectives(1)} {
+		interface.setArmCount(2);
+		for (auto index = std::size_t{}; index < 2; ++index) {
+			controllers.push_back(
+			    KinovaZED::Control::makeCoreController(interface, arms[index], index, objectives, logger));
+			interface.deliver(Command{Command::Id::QuitEStop, {}, index});
+		}
+		interface.notifications.clear();
+		interface.notifiedArms.clear();
+	}
+
+	FakeInterface interface{};
+	FakeArm arms[2]{};
+	ObjectiveManager objectives;
+	std::vector<std::shared_ptr<CoreController>> controllers{};
+};
+
+void testEStopWithoutArmStopsAllArms() {
+	auto fixture = TwoArmFixture{};
+
+	fixture.interface.deliver(Command{Command::Id::EStop, {}});
+
+	ASSERT_EQUAL((std::vector<std::string>{"stopMoving"}), fixture.arms[0].calls);
+	ASSERT_EQUAL((std::vector<std::string>{"stopMoving"}), fixture.arms[1].calls);
+	ASSERT_EQUAL(2, fixture.interface.count(Notification::Id::Accepted));
+}
+
+void testAddressedEStopOnlyStopsTheGivenArm() {
+	auto fixture = TwoArmFixture{};
+
+	fixture.interface.deliver(Command{Command::Id::EStop, {}, 1});
+
+	ASSERT(fixture.arms[0].calls.empty());
+	ASSERT_EQUAL((std::vector<std::string>{"stopMoving"}), fixture.arms[1].calls);
+	ASSERT_EQUAL(std::vector<std::size_t>{1}, fixture.interface.notifiedArms);
+}
+
+void testCommandWithoutArmOnlyReachesTheFirstArm() {
+	auto fixture = TwoArmFixture{};
+
+	fixture.interface.deliver(Command{Command::Id::Initialize, {}});
+
+	ASSERT_EQUAL(std::vector<std::size_t>{0}, fixture.interface.notifiedArms);
+}
+
+void testCommandForUnknownArmIsRejected() {
+	auto fixture = TwoArmFixture{};
+
+	fixture.interface.deliver(Command{Command::Id::Initialize, {}, 7});
+
+	ASSERT(fixture.arms[0].calls.empty());
+	ASSERT(fixture.arms[1].calls.empty());
+	ASSERT_EQUAL(std::vector<Notification::Id>{Notification::Id::Rejected}, fixture.interface.notifications);
+	ASSERT_EQUAL(std::vector<std::size_t>{7}, fixture.interface.notifiedArms);
+}
+
+cute::suite make_suite_CoreControllerSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testRunObjectiveQueuesLookaheadBehindFirstWaypoint));
+	s.push_back(CUTE(testReachedWaypointQueuesNextWaypointWithoutStopping));
+	s.push_back(CUTE(testObjectiveIsDoneOnlyOnceTheLastQueuedWaypointIsReached));
+	s.push_back(CUTE(testFinishingAnObjectiveDoesNotStopTheArm));
+	s.push_back(CUTE(testObjectiveShorterThanLookaheadQueuesAllWaypoints));
+	s.push_back(CUTE(testWithoutLookaheadEveryWaypointIsApproachedSeparately));
+	s.push_back(CUTE(testEStopDuringPendingStopDoesNotStartTheObjective));
+	s.push_back(CUTE(testObjectiveDuringPendingStopOnlyStartsTheNewObjective));
+	s.push_back(CUTE(testUnreachableWaypointAbortsTheObjectiveWithoutLookahead));
+	s.push_back(CUTE(testUnreachableWaypointAbortsTheObjectiveWithLookahead));
+	s.push_back(CUTE(testUnreachableWaypointWithinTheLookaheadRejectsTheObjective));
+	s.push_back(CUTE(testReachedPositionOutsideOfSequenceIsIgnored));
+	s.push_back(CUTE(testEStopWithoutArmStopsAllArms));
+	s.push_back(CUTE(testAddressedEStopOnlyStopsTheGivenArm));
+	s.push_back(CUTE(testCommandWithoutArmOnlyReachesTheFirstArm));
+	s.push_back(CUTE(testCommandForUnknownArmIsRejected));
+	return s;
+}
@@ -0,0 +1,139 @@
+#include "CurrentMonitorSuite.h"
+
+#include "hw/CurrentMonitor.h"
+
+#include <cute/cute.h>
+
+#include <cstddef>
+
+using KinovaZED::Hw::CurrentMonitor;
+
+using Level = CurrentMonitor::Level;
+
+auto const quiet = CurrentMonitor::JointCurrents{0.2f, 0.2f, 0.2f, 0.1f, 0.1f, 0.1f};
+
+void testStatisticsOfConstantCurrents() {
+	auto monitor = CurrentMonitor{};
+	for (auto sample = std::size_t{}; sample < 5; ++sample) {
+		monitor.record(quiet);
+	}
+
+	ASSERT_EQUAL(5, monitor.size());
+	ASSERT_EQUAL_DELTA(0.2f, monitor.mean()[0], 1e-6f);
+	ASSERT_EQUAL_DELTA(0.1f, monitor.mean()[5], 1e-6f);
+	ASSERT_EQUAL_DELTA(0.0f, monitor.variance()[0], 1e-6f);
+	ASSERT_EQUAL_DELTA(0.0f, monitor.slope()[0], 1e-6f);
+	ASSERT_EQUAL(Level::Normal, monitor.level());
+}
+
+void testSlopeOfLinearlyRisingCurrent() {
+	auto monitor = CurrentMonitor{};
+	for (auto sample = 0; sample < 4; ++sample) {
+		auto currents = quiet;
+		currents[1] = 0.1f * static_cast<float>(sample);
+		monitor.record(currents);
+	}
+
+	ASSERT_EQUAL_DELTA(0.1f, monitor.slope()[1], 1e-5f);
+	ASSERT_EQUAL_DELTA(0.15f, monitor.mean()[1], 1e-5f);
+	ASSERT_EQUAL_DELTA(0.0125f, monitor.variance()[1], 1e-5f);
+}
+
+void testWindowOnlyKeepsRecentSamples() {
+	auto monitor = CurrentMonitor{};
+	auto high = quiet;
+	high[0] = 1.0f;
+
+	monitor.record(high);
+	for (auto sample = std::size_t{}; sample < CurrentMonitor::windowSize; ++sample) {
+		monitor.record(quiet);
+	}
+
+	ASSERT_EQUAL(CurrentMonitor::windowSize, monitor.size());
+	ASSERT_EQUAL_DELTA(0.2f, monitor.mean()[0], 1e-6f);
+}
+
+void testSingleSpikeDoesNotTripHardLimit() {
+	auto monitor = CurrentMonitor{};
+	for (auto sample = std::size_t{}; sample < 8; ++sample) {
+		monitor.record(quiet);
+	}
+
+	auto spike = quiet;
+	spike[2] = 5.0f;
+
+	ASSERT_NOT_EQUAL_TO(Level::Hard, monitor.record(spike));
+	ASSERT_NOT_EQUAL_TO(Level::Hard, monitor.record(quiet));
+}
+
+void testSustainedOvercurrentTripsHardLimit() {
+	auto monitor = CurrentMonitor{};
+	auto high = quiet;
+	high[2] = 3.0f;
+
+	monitor.record(high);
+	monitor.record(high);
+	ASSERT_EQUAL(Level::Hard, monitor.record(high));
+}
+
+void testTotalCurrentIsLimited() {
+	auto monitor = CurrentMonitor{};
+	auto const high = CurrentMonitor::JointCurrents{1.2f, 1.2f, 1.2f, 0.8f, 0.8f, 0.8f};
+
+	monitor.record(high);
+	monitor.record(high);
+	ASSERT_EQUAL(Level::Hard, monitor.record(high));
+}
+
+void testSoftLimitSlowsDownBeforeHardLimit() {
+	auto monitor = CurrentMonitor{};
+	auto elevated = quiet;
+	elevated[3] = 1.2f;
+
+	monitor.record(elevated);
+	monitor.record(elevated);
+	ASSERT_EQUAL(Level::Soft, monitor.record(elevated));
+}
+
+void testRisingTrendIsReportedEarly() {
+	auto monitor = CurrentMonitor{};
+	auto level = Level::Normal;
+
+	for (auto sample = std::size_t{}; sample < CurrentMonitor::windowSize; ++sample) {
+		auto currents = quiet;
+		currents[0] = 0.2f + 0.1f * static_cast<float>(sample);
+		level = monitor.record(currents);
+	}
+
+	ASSERT_LESS(monitor.mean()[0], 1.5f);
+	ASSERT_EQUAL(Level::Soft, level);
+}
+
+void testRecoveryReturnsToNormal() {
+	auto monitor = CurrentMonitor{};
+	auto elevated = quiet;
+	elevated[3] = 1.2f;
+
+	for (auto sample = std::size_t{}; sample < 3; ++sample) {
+		monitor.record(elevated);
+	}
+	for (auto sample = std::size_t{}; sample < CurrentMonitor::windowSize; ++sample) {
+		monitor.record(quiet);
+	}
+
+	ASSERT_EQUAL(Level::Normal, monitor.level());
+}
+
+cute::suite make_suite_CurrentMonitorSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testStatisticsOfConstantCurrents));
+	s.push_back(CUTE(testSlopeOfLinearlyRisingCurrent));
+	s.push_back(CUTE(testWindowOnlyKeepsRecentSamples));
+	s.push_back(CUTE(testSingleSpikeDoesNotTripHardLimit));
+	s.push_back(CUTE(testSustainedOvercurrentTripsHardLimit));
+	s.push_back(CUTE(testTotalCurrentIsLimited));
+	s.push_back(CUTE(testSoftLimitSlowsDownBeforeHardLimit));
+	s.push_back(CUTE(testRisingTrendIsReportedEarly));
+	s.push_back(CUTE(testRecoveryReturnsToNormal));
+	return s;
+}
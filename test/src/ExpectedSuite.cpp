@@ -0,0 +1,61 @@
+#include "ExpectedSuite.h"
+
+#include "support/Expected.h"
+
+#include <cute/cute.h>
+
+#include <string>
+
+using KinovaZED::BadExpectedAccess;
+using KinovaZED::Expected;
+using KinovaZED::Unexpected;
+
+namespace {
+
+enum struct ParseError {
+	Empty,
+	Negative,
+};
+
+auto parse(int raw) -> Expected<std::string, ParseError> {
+	if (!raw) {
+		return Unexpected{ParseError::Empty};
+	}
+	if (raw < 0) {
+		return Unexpected{ParseError::Negative};
+	}
+	return std::to_string(raw);
+}
+
+} // namespace
+
+void testExpectedHoldsTheValue() {
+	auto result = parse(42);
+
+	ASSERT(result.hasValue());
+	ASSERT_EQUAL("42", *result);
+	ASSERT_EQUAL("42", result.value());
+	ASSERT_EQUAL(2, result->size());
+}
+
+void testExpectedHoldsTheError() {
+	auto result = parse(-1);
+
+	ASSERT(!result);
+	ASSERT(result.error() == ParseError::Negative);
+	ASSERT_EQUAL("fallback", result.valueOr("fallback"));
+}
+
+void testAccessingTheValueOfAnErrorThrows() {
+	auto result = parse(0);
+
+	ASSERT_THROWS(result.value(), BadExpectedAccess);
+}
+
+cute::suite make_suite_ExpectedSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testExpectedHoldsTheValue));
+	s.push_back(CUTE(testExpectedHoldsTheError));
+	s.push_back(CUTE(testAccessingTheValueOfAnErrorThrows));
+	return s;
+}
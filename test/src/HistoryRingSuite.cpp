@@ -0,0 +1,115 @@
+#include "HistoryRingSuite.h"
+
+#include "support/HistoryRing.h"
+
+#include <cute/cute.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct TestSample {
+	std::chrono::steady_clock::time_point timestamp{};
+	std::uint64_t sequence{};
+	std::uint64_t checksum{};
+};
+
+using TestRing = KinovaZED::HistoryRing<TestSample, 8>;
+
+auto makeSample(std::uint64_t sequence, std::chrono::steady_clock::time_point epoch = {}) -> TestSample {
+	return {epoch + std::chrono::milliseconds{sequence}, sequence, ~sequence};
+}
+
+auto sequencesOf(std::vector<TestSample> const &samples) -> std::vector<std::uint64_t> {
+	auto sequences = std::vector<std::uint64_t>{};
+	transform(cbegin(samples), cend(samples), back_inserter(sequences), [](auto sample) { return sample.sequence; });
+	return sequences;
+}
+
+void testEmptyRingYieldsNoSamples() {
+	auto const ring = TestRing{};
+	auto samples = std::vector<TestSample>{};
+	ring.last(4, back_inserter(samples));
+	ASSERT(samples.empty());
+}
+
+void testLastReturnsMostRecentSamplesOldestFirst() {
+	auto ring = TestRing{};
+	for (auto sequence = 0u; sequence < 5; ++sequence) {
+		ring.push(makeSample(sequence));
+	}
+
+	auto samples = std::vector<TestSample>{};
+	ring.last(3, back_inserter(samples));
+	ASSERT_EQUAL((std::vector<std::uint64_t>{2, 3, 4}), sequencesOf(samples));
+}
+
+void testLastIsLimitedByCapacity() {
+	auto ring = TestRing{};
+	for (auto sequence = 0u; sequence < 20; ++sequence) {
+		ring.push(makeSample(sequence));
+	}
+
+	auto samples = std::vector<TestSample>{};
+	ring.last(100, back_inserter(samples));
+	ASSERT_EQUAL((std::vector<std::uint64_t>{12, 13, 14, 15, 16, 17, 18, 19}), sequencesOf(samples));
+	ASSERT_EQUAL(20, ring.size());
+}
+
+void testSinceReturnsSamplesNotOlderThanTheGivenTime() {
+	auto ring = TestRing{};
+	auto const epoch = std::chrono::steady_clock::now();
+	for (auto sequence = 0u; sequence < 6; ++sequence) {
+		ring.push(makeSample(sequence, epoch));
+	}
+
+	auto samples = std::vector<TestSample>{};
+	ring.since(epoch + 4ms, back_inserter(samples));
+	ASSERT_EQUAL((std::vector<std::uint64_t>{4, 5}), sequencesOf(samples));
+}
+
+void testConcurrentReadersNeverObserveTornOrReorderedSamples() {
+	auto ring = TestRing{};
+	auto done = std::atomic_bool{false};
+
+	auto writer = std::thread{[&] {
+		for (auto sequence = 0u; sequence < 200000; ++sequence) {
+			ring.push(makeSample(sequence));
+		}
+		done = true;
+	}};
+
+	auto samples = std::vector<TestSample>{};
+	samples.reserve(TestRing::capacity());
+	auto consistent = true;
+
+	while (!done) {
+		samples.clear();
+		ring.last(TestRing::capacity(), back_inserter(samples));
+		consistent &= std::all_of(cbegin(samples), cend(samples), [](auto sample) {
+			return sample.checksum == ~sample.sequence;
+		});
+		consistent &= std::is_sorted(cbegin(samples), cend(samples), [](auto lhs, auto rhs) {
+			return lhs.sequence < rhs.sequence;
+		});
+	}
+
+	writer.join();
+	ASSERT(consistent);
+}
+
+cute::suite make_suite_HistoryRingSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testEmptyRingYieldsNoSamples));
+	s.push_back(CUTE(testLastReturnsMostRecentSamplesOldestFirst));
+	s.push_back(CUTE(testLastIsLimitedByCapacity));
+	s.push_back(CUTE(testSinceReturnsSamplesNotOlderThanTheGivenTime));
+	s.push_back(CUTE(testConcurrentReadersNeverObserveTornOrReorderedSamples));
+	return s;
+}
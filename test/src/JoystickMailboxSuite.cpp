@@ -0,0 +1,63 @@
+#include "JoystickMailboxSuite.h"
+
+#include "hw/JoystickMailbox.h"
+
+#include <cute/cute.h>
+
+using KinovaZED::Hw::JoystickMailbox;
+
+void testEmptyMailboxHasNothingToTake() {
+	auto mailbox = JoystickMailbox{};
+	ASSERT(!mailbox.take());
+}
+
+void testTakeReturnsPostedDeflection() {
+	auto mailbox = JoystickMailbox{};
+	mailbox.post({10, -20, 30});
+
+	auto deflection = mailbox.take();
+	ASSERT(deflection);
+	ASSERT_EQUAL(10, deflection->x);
+	ASSERT_EQUAL(-20, deflection->y);
+	ASSERT_EQUAL(30, deflection->z);
+}
+
+void testTakeEmptiesTheMailbox() {
+	auto mailbox = JoystickMailbox{};
+	mailbox.post({1, 2, 3});
+	mailbox.take();
+	ASSERT(!mailbox.take());
+}
+
+void testLatestPostWins() {
+	auto mailbox = JoystickMailbox{};
+	ASSERT(!mailbox.post({1, 1, 1}));
+	ASSERT(mailbox.post({2, 2, 2}));
+
+	auto deflection = mailbox.take();
+	ASSERT_EQUAL(2, deflection->x);
+}
+
+void testNeutralDeflectionIsStillPending() {
+	auto mailbox = JoystickMailbox{};
+	mailbox.post({0, 0, 0});
+	ASSERT(mailbox.take());
+}
+
+void testClearDropsPendingDeflection() {
+	auto mailbox = JoystickMailbox{};
+	mailbox.post({5, 5, 5});
+	mailbox.clear();
+	ASSERT(!mailbox.take());
+}
+
+cute::suite make_suite_JoystickMailboxSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testEmptyMailboxHasNothingToTake));
+	s.push_back(CUTE(testTakeReturnsPostedDeflection));
+	s.push_back(CUTE(testTakeEmptiesTheMailbox));
+	s.push_back(CUTE(testLatestPostWins));
+	s.push_back(CUTE(testNeutralDeflectionIsStillPending));
+	s.push_back(CUTE(testClearDropsPendingDeflection));
+	return s;
+}
@@ -0,0 +1,164 @@
+#include "KernelSuite.h"
+
+#include "MatrixHelper.h"
+
+#include "hw/Coordinates.h"
+#include "math/Matrix.h"
+
+#include <cute/cute.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using KinovaZED::getEulerAngles;
+using KinovaZED::Mat4;
+using KinovaZED::rotationOf;
+using KinovaZED::rotMatrix;
+using KinovaZED::Vec3;
+using KinovaZED::Hw::Coordinates;
+
+namespace Kernels = KinovaZED::Kernels;
+
+namespace {
+
+/**
+ * The largest difference between the scalar and the vectorized kernels that is accepted
+ *
+ * Both variants accumulate in the same order, so they only differ if the compiler contracts multiplications and
+ * additions into fused operations.
+ */
+auto constexpr maximumUlps = std::int64_t{4};
+
+Mat4 const openDoorTransformationMatrix{{{0.498557, -0.0310022, 0.866302, 0.212972},
+                                         {0.866681, -0.00230676, -0.498857, -0.271539},
+                                         {0.017464, 0.999517, 0.025719, 0.491391},
+                                         {0.0, 0.0, 0.0, 1.0}}};
+
+/**
+ * The waypoints of the OpenDoor sequence and their coordinates in the base frame, as checked in MatrixSuite
+ */
+std::array<std::pair<Coordinates, Coordinates>, 6> const openDoorReferences{{
+    {{-0.003, 0.008, 0, -0.027, -0.008, 0.713}, {0.211228, -0.274157, 0.499335, 1.46724, 1.03749, 0.820169}},
+    {{-0.033, 0.015, -0.197, -0.06, 0.192, 0.598}, {0.0253932, -0.201899, 0.50074, 1.30707, 1.22903, 0.847925}},
+    {{-0.063, 0, -0.19, -0.059, 0.069, -1.543}, {0.0169657, -0.231357, 0.485404, 1.37741, 1.10907, -1.35781}},
+    {{-0.07, 0.083, -0.188, -0.053, 0.055, -1.555}, {0.0126352, -0.238613, 0.568293, 1.39595, 1.09635, -1.385981}},
+    {{0.171, 0.03, -0.319, -0.006, 0.614, -0.106}, {0.0209449, 0.0357301, 0.516158, -1.19642, 1.47223, 2.65887}},
+    {{0.163, -0.191, -0.039, 0.023, 0.216, -0.125}, {0.266373, -0.110374, 0.302327, 1.54954, 1.26463, -0.0882606}},
+}};
+
+auto transformationOf(Coordinates const &coordinates) -> Mat4 {
+	auto const angles = std::array{coordinates.pitch, coordinates.yaw, coordinates.roll};
+	auto const rotation = rotMatrix(angles.data());
+	return {{{rotation[0][0], rotation[0][1], rotation[0][2], coordinates.x},
+	         {rotation[1][0], rotation[1][1], rotation[1][2], coordinates.y},
+	         {rotation[2][0], rotation[2][1], rotation[2][2], coordinates.z},
+	         {0, 0, 0, 1}}};
+}
+
+template<typename Compose>
+auto assertReproducesOpenDoorReferences(Compose compose) {
+	for (auto const &[waypoint, expected] : openDoorReferences) {
+		auto const combined = compose(openDoorTransformationMatrix, transformationOf(waypoint));
+		auto const position = Vec3{combined[0][3], combined[1][3], combined[2][3]};
+		assertArrayEqual(Vec3{expected.x, expected.y, expected.z}, position);
+		assertArrayEqual(Vec3{expected.pitch, expected.yaw, expected.roll}, getEulerAngles(rotationOf(combined)));
+	}
+}
+
+auto identity() -> Mat4 {
+	return {{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}};
+}
+
+} // namespace
+
+void testScalarComposeReproducesOpenDoorReferences() {
+	assertReproducesOpenDoorReferences(Kernels::Scalar::compose<float>);
+}
+
+void testVectorizedComposeReproducesOpenDoorReferences() {
+	assertReproducesOpenDoorReferences(Kernels::Vectorized::compose);
+}
+
+void testVectorizedComposeStaysWithinUlpBoundOfScalar() {
+	for (auto const &reference : openDoorReferences) {
+		auto const waypoint = transformationOf(reference.first);
+		auto const scalar = Kernels::Scalar::compose(openDoorTransformationMatrix, waypoint);
+		auto const vectorized = Kernels::Vectorized::compose(openDoorTransformationMatrix, waypoint);
+		ASSERT_LESS_EQUAL(maximumUlpDistance(scalar, vectorized), maximumUlps);
+	}
+}
+
+void testComposeOfIntegerMatricesIsExact() {
+	Mat4 const lhs{{{1.0, 2.0, 3.0, 4.0}, {2.0, 3.0, 4.0, 5.0}, {3.0, 4.0, 5.0, 6.0}, {4.0, 5.0, 6.0, 7.0}}};
+	Mat4 const rhs{{{0.0, 1.0, 2.0, 4.0}, {1.0, 2.0, 4.0, 8.0}, {2.0, 4.0, 8.0, 16.0}, {4.0, 8.0, 16.0, 32.0}}};
+	Mat4 const expected{{{24.0, 49.0, 98.0, 196.0},
+	                     {31.0, 64.0, 128.0, 256.0},
+	                     {38.0, 79.0, 158.0, 316.0},
+	                     {45.0, 94.0, 188.0, 376.0}}};
+	ASSERT_EQUAL(expected, Kernels::Scalar::compose(lhs, rhs));
+	ASSERT_EQUAL(expected, Kernels::Vectorized::compose(lhs, rhs));
+}
+
+void testVectorizedInvertRigidStaysWithinUlpBoundOfScalar() {
+	auto const scalar = Kernels::Scalar::invertRigid(openDoorTransformationMatrix);
+	auto const vectorized = Kernels::Vectorized::invertRigid(openDoorTransformationMatrix);
+	ASSERT_LESS_EQUAL(maximumUlpDistance(scalar, vectorized), maximumUlps);
+}
+
+void testInvertRigidUndoesTheTransformation() {
+	auto const inverted = Kernels::invertRigid(openDoorTransformationMatrix);
+	assertMatrixEqual(identity(), Kernels::compose(inverted, openDoorTransformationMatrix));
+}
+
+void testVectorizedTransformPointStaysWithinUlpBoundOfScalar() {
+	for (auto const &[waypoint, expected] : openDoorReferences) {
+		auto const point = Vec3{waypoint.x, waypoint.y, waypoint.z};
+		auto const scalar = Kernels::Scalar::transformPoint(openDoorTransformationMatrix, point);
+		auto const vectorized = Kernels::Vectorized::transformPoint(openDoorTransformationMatrix, point);
+		assertArrayEqual(Vec3{expected.x, expected.y, expected.z}, vectorized);
+		for (auto axis = std::size_t{}; axis < 3; ++axis) {
+			ASSERT_LESS_EQUAL(ulpDistance(scalar[axis], vectorized[axis]), maximumUlps);
+		}
+	}
+}
+
+void testTransformPointsMatchesTransformPoint() {
+	auto points = std::vector<Vec3>{};
+	for (auto const &reference : openDoorReferences) {
+		points.push_back({reference.first.x, reference.first.y, reference.first.z});
+	}
+	auto scalar = std::vector<Vec3>(points.size());
+	auto vectorized = std::vector<Vec3>(points.size());
+
+	Kernels::Scalar::transformPoints(openDoorTransformationMatrix, points.data(), scalar.data(), points.size());
+	Kernels::Vectorized::transformPoints(openDoorTransformationMatrix, points.data(), vectorized.data(), points.size());
+
+	for (auto index = std::size_t{}; index < points.size(); ++index) {
+		ASSERT_EQUAL(Kernels::Scalar::transformPoint(openDoorTransformationMatrix, points[index]), scalar[index]);
+		ASSERT_EQUAL(Kernels::Vectorized::transformPoint(openDoorTransformationMatrix, points[index]),
+		             vectorized[index]);
+	}
+}
+
+void testTransformPointsWithoutPointsDoesNothing() {
+	auto output = Vec3{1, 2, 3};
+	Kernels::transformPoints(openDoorTransformationMatrix, nullptr, &output, 0);
+	ASSERT_EQUAL((Vec3{1, 2, 3}), output);
+}
+
+cute::suite make_suite_KernelSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testScalarComposeReproducesOpenDoorReferences));
+	s.push_back(CUTE(testVectorizedComposeReproducesOpenDoorReferences));
+	s.push_back(CUTE(testVectorizedComposeStaysWithinUlpBoundOfScalar));
+	s.push_back(CUTE(testComposeOfIntegerMatricesIsExact));
+	s.push_back(CUTE(testVectorizedInvertRigidStaysWithinUlpBoundOfScalar));
+	s.push_back(CUTE(testInvertRigidUndoesTheTransformation));
+	s.push_back(CUTE(testVectorizedTransformPointStaysWithinUlpBoundOfScalar));
+	s.push_back(CUTE(testTransformPointsMatchesTransformPoint));
+	s.push_back(CUTE(testTransformPointsWithoutPointsDoesNothing));
+	return s;
+}
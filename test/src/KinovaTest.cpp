@@ -1,8 +1,28 @@
+#include "CoordinatesSuite.h"
+#include "CoreControllerSuite.h"
+#include "CurrentMonitorSuite.h"
+#include "ExpectedSuite.h"
+#include "HistoryRingSuite.h"
 #include "IntegrationSuite.h"
+#include "JoystickMailboxSuite.h"
+#include "KernelSuite.h"
 #include "KinovaArmSuite.h"
+#include "LatencyHistogramSuite.h"
+#include "LineCommandFactorySuite.h"
 #include "MatrixSuite.h"
+#include "ObjectiveManagerSuite.h"
+#include "ObjectiveSuite.h"
+#include "PoseSuite.h"
 #include "PositionHandlingSuite.h"
+#include "PrecisionSuite.h"
+#include "ReconnectorSuite.h"
+#include "SeqLockSuite.h"
 #include "SequenceSuite.h"
+#include "SimulatedArmSuite.h"
+#include "StepSequencerSuite.h"
+#include "SubscriberListSuite.h"
+#include "TelemetryRecorderSuite.h"
+#include "TransactionStatisticsSuite.h"
 
 #include <cute/cute.h>
 #include <cute/cute_runner.h>
@@ -56,8 +76,28 @@ int main(int argc, char **argv) {
 	    std::pair{make_suite_MatrixSuite(), "Matrix Operations"s},
 	    std::pair{make_suite_PositionHandlingSuite(), "Position Handling"s},
 	    std::pair{make_suite_SequenceSuite(), "Sequencing"s},
+	    std::pair{make_suite_CoreControllerSuite(), "Core Controller"s},
+	    std::pair{make_suite_SimulatedArmSuite(), "Simulated Arm"s},
+	    std::pair{make_suite_StepSequencerSuite(), "Step Sequencing"s},
+	    std::pair{make_suite_ReconnectorSuite(), "Reconnection"s},
 	    std::pair{make_suite_IntegrationSuite(), "Integration Tests"s},
 	    std::pair{make_suite_KinovaArmSuite(), "Kinova Arm"s},
+	    std::pair{make_suite_LatencyHistogramSuite(), "Latency Histogram"s},
+	    std::pair{make_suite_HistoryRingSuite(), "History Ring"s},
+	    std::pair{make_suite_SeqLockSuite(), "Sequence Lock"s},
+	    std::pair{make_suite_JoystickMailboxSuite(), "Joystick Mailbox"s},
+	    std::pair{make_suite_TransactionStatisticsSuite(), "Transaction Statistics"s},
+	    std::pair{make_suite_CurrentMonitorSuite(), "Current Monitor"s},
+	    std::pair{make_suite_LineCommandFactorySuite(), "Line Command Factory"s},
+	    std::pair{make_suite_SubscriberListSuite(), "Subscriber List"s},
+	    std::pair{make_suite_CoordinatesSuite(), "Coordinates"s},
+	    std::pair{make_suite_ExpectedSuite(), "Expected"s},
+	    std::pair{make_suite_TelemetryRecorderSuite(), "Telemetry Recorder"s},
+	    std::pair{make_suite_PoseSuite(), "Poses"s},
+	    std::pair{make_suite_ObjectiveSuite(), "Objectives"s},
+	    std::pair{make_suite_ObjectiveManagerSuite(), "Objective Manager"s},
+	    std::pair{make_suite_KernelSuite(), "Transformation Kernels"s},
+	    std::pair{make_suite_PrecisionSuite(), "Scalar Type Precision"s},
 	};
 
 	auto selectors = get_test_selectors(suites);
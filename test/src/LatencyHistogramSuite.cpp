@@ -0,0 +1,71 @@
+#include "LatencyHistogramSuite.h"
+
+#include "support/LatencyHistogram.h"
+
+#include <cute/cute.h>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+using KinovaZED::LatencyHistogram;
+
+void testEmptyHistogramHasNoSamples() {
+	auto const histogram = LatencyHistogram{};
+	ASSERT_EQUAL(0, histogram.count());
+	ASSERT_EQUAL(0, histogram.mean().count());
+	ASSERT_EQUAL(0, histogram.percentile(.99).count());
+}
+
+void testSamplesAreSortedIntoPowerOfTwoBuckets() {
+	auto histogram = LatencyHistogram{};
+	histogram.record(500ns);
+	histogram.record(1us);
+	histogram.record(3us);
+	histogram.record(1000us);
+
+	ASSERT_EQUAL(1, histogram.bucket(0));
+	ASSERT_EQUAL(1, histogram.bucket(1));
+	ASSERT_EQUAL(1, histogram.bucket(2));
+	ASSERT_EQUAL(1, histogram.bucket(10));
+	ASSERT_EQUAL(4, histogram.count());
+}
+
+void testOversizedSamplesEndUpInTheLastBucket() {
+	auto histogram = LatencyHistogram{};
+	histogram.record(2s);
+
+	ASSERT_EQUAL(1, histogram.bucket(LatencyHistogram::bucketCount - 1));
+	ASSERT_EQUAL(std::chrono::nanoseconds{2s}.count(), histogram.upperBound(LatencyHistogram::bucketCount - 1).count());
+}
+
+void testPercentileReportsBucketUpperBound() {
+	auto histogram = LatencyHistogram{};
+	for (auto sample = 0; sample < 99; ++sample) {
+		histogram.record(100us);
+	}
+	histogram.record(5ms);
+
+	ASSERT_EQUAL(std::chrono::nanoseconds{128us}.count(), histogram.percentile(.5).count());
+	ASSERT_EQUAL(std::chrono::nanoseconds{128us}.count(), histogram.percentile(.99).count());
+	ASSERT_EQUAL(std::chrono::nanoseconds{5ms}.count(), histogram.percentile(1.).count());
+}
+
+void testMeanAndMaximum() {
+	auto histogram = LatencyHistogram{};
+	histogram.record(1ms);
+	histogram.record(3ms);
+
+	ASSERT_EQUAL(std::chrono::nanoseconds{2ms}.count(), histogram.mean().count());
+	ASSERT_EQUAL(std::chrono::nanoseconds{3ms}.count(), histogram.max().count());
+}
+
+cute::suite make_suite_LatencyHistogramSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testEmptyHistogramHasNoSamples));
+	s.push_back(CUTE(testSamplesAreSortedIntoPowerOfTwoBuckets));
+	s.push_back(CUTE(testOversizedSamplesEndUpInTheLastBucket));
+	s.push_back(CUTE(testPercentileReportsBucketUpperBound));
+	s.push_back(CUTE(testMeanAndMaximum));
+	return s;
+}
@@ -0,0 +1,112 @@
+#include "LineCommandFactorySuite.h"
+
+#include "comm/Command.h"
+#include "comm/Heartbeat.h"
+#include "comm/Notification.h"
+#include "support/LineCommandFactory.h"
+#include "support/ToString.h"
+
+#include <cute/cute.h>
+
+#include <any>
+#include <string>
+
+using KinovaZED::lineCommandFactory;
+using KinovaZED::toString;
+using KinovaZED::Comm::Command;
+using KinovaZED::Comm::Heartbeat;
+using KinovaZED::Comm::Notification;
+
+void testCommandWithoutArmIsAddressedToTheFirstArm() {
+	auto command = lineCommandFactory("Initialize");
+
+	ASSERT(command.has_value());
+	ASSERT_EQUAL(static_cast<int>(Command::Id::Initialize), static_cast<int>(command->id));
+	ASSERT(!command->arm);
+	ASSERT(command->isAddressedTo(0));
+	ASSERT(!command->isAddressedTo(1));
+}
+
+void testEStopWithoutArmIsAddressedToAllArms() {
+	auto command = lineCommandFactory("EStop");
+
+	ASSERT(command.has_value());
+	ASSERT(!command->arm);
+	ASSERT(command->isAddressedTo(0));
+	ASSERT(command->isAddressedTo(1));
+	ASSERT(command->isAddressedTo(7));
+}
+
+void testAddressedEStopIsOnlyAddressedToTheGivenArm() {
+	auto command = lineCommandFactory("EStop@1");
+
+	ASSERT(command.has_value());
+	ASSERT(!command->isAddressedTo(0));
+	ASSERT(command->isAddressedTo(1));
+}
+
+void testCommandIsAddressedToTheGivenArm() {
+	auto command = lineCommandFactory("Retract@3");
+
+	ASSERT(command.has_value());
+	ASSERT_EQUAL(static_cast<int>(Command::Id::Retract), static_cast<int>(command->id));
+	ASSERT(command->arm);
+	ASSERT_EQUAL(3, *command->arm);
+	ASSERT(command->isAddressedTo(3));
+	ASSERT(!command->isAddressedTo(0));
+}
+
+void testAddressedCommandKeepsItsParameters() {
+	auto command = lineCommandFactory("MoveJoystick@1:10:-20:30");
+
+	ASSERT(command.has_value());
+	ASSERT(command->arm);
+	ASSERT_EQUAL(1, *command->arm);
+	ASSERT_EQUAL(3, command->parameters.size());
+	ASSERT_EQUAL(-20, std::any_cast<int>(command->parameters[1]));
+}
+
+void testMalformedArmIndexIsRejected() {
+	ASSERT(!lineCommandFactory("Initialize@"));
+	ASSERT(!lineCommandFactory("Initialize@first"));
+	ASSERT(!lineCommandFactory("Initialize@-1"));
+	ASSERT(!lineCommandFactory("@1"));
+}
+
+void testMalformedJoystickValuesAreRejected() {
+	ASSERT(!lineCommandFactory("MoveJoystick:1:x:3"));
+	ASSERT(!lineCommandFactory("MoveJoystick:1:2:3abc"));
+	ASSERT(!lineCommandFactory("MoveJoystick:1:2:99999999999"));
+}
+
+void testJoystickValuesMayBeSurroundedBySpaces() {
+	auto command = lineCommandFactory("MoveJoystick: 1 :2: -3");
+
+	ASSERT(command.has_value());
+	ASSERT_EQUAL(-3, std::any_cast<int>(command->parameters[2]));
+}
+
+void testNotificationsOfTheFirstArmAreNotTagged() {
+	ASSERT_EQUAL("Accepted", toString(Notification{Notification::Id::Accepted}));
+	ASSERT_EQUAL("Accepted@2", toString(Notification{Notification::Id::Accepted, 2}));
+}
+
+void testHeartbeatsOfTheFirstArmAreNotTagged() {
+	ASSERT_EQUAL("Heartbeat:5", toString(Heartbeat{5}));
+	ASSERT_EQUAL("Heartbeat@1:5", toString(Heartbeat{5, 1}));
+}
+
+cute::suite make_suite_LineCommandFactorySuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testCommandWithoutArmIsAddressedToTheFirstArm));
+	s.push_back(CUTE(testEStopWithoutArmIsAddressedToAllArms));
+	s.push_back(CUTE(testAddressedEStopIsOnlyAddressedToTheGivenArm));
+	s.push_back(CUTE(testCommandIsAddressedToTheGivenArm));
+	s.push_back(CUTE(testAddressedCommandKeepsItsParameters));
+	s.push_back(CUTE(testMalformedArmIndexIsRejected));
+	s.push_back(CUTE(testMalformedJoystickValuesAreRejected));
+	s.push_back(CUTE(testJoystickValuesMayBeSurroundedBySpaces));
+	s.push_back(CUTE(testNotificationsOfTheFirstArmAreNotTagged));
+	s.push_back(CUTE(testHeartbeatsOfTheFirstArmAreNotTagged));
+	return s;
+}
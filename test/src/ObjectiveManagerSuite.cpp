@@ -0,0 +1,100 @@
+#include "ObjectiveManagerSuite.h"
+
+#include "control/EmbeddedObjectives.h"
+#include "control/Objective.h"
+#include "control/ObjectiveManager.h"
+#include "hw/Coordinates.h"
+#include "support/Logging.h"
+#include "support/ToString.h"
+
+#include <cute/cute.h>
+#include <nlohmann/json.hpp>
+
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+using KinovaZED::toString;
+using KinovaZED::Control::EMBEDDED_OBJECTIVES;
+using KinovaZED::Control::EMBEDDED_WAYPOINTS;
+using KinovaZED::Control::EmbeddedObjective;
+using KinovaZED::Control::Objective;
+using KinovaZED::Control::ObjectiveManager;
+using KinovaZED::Hw::Coordinates;
+
+namespace {
+
+auto const logger = KinovaZED::makeLogger({"ObjectiveManagerSuite", {}, {}, {}});
+
+Coordinates const firstWaypoint{-0.003, 0.008, 0, -0.027, -0.008, 0.713};
+Coordinates const secondWaypoint{-0.033, 0.015, -0.197, -0.06, 0.192, 0.598};
+
+/**
+ * An objective that is embedded if the objectives were compiled into the application
+ */
+auto const replacedId = EMBEDDED_OBJECTIVES.empty() ? Objective::Id::OpenDoor : EMBEDDED_OBJECTIVES.front().id;
+
+auto makeObjective(Objective::Id id, std::vector<Coordinates> const &sequence) -> nlohmann::json {
+	return {{"name", toString(id)}, {"origin", Coordinates{}}, {"sequence", sequence}, {"is_abs", false}};
+}
+
+auto sequenceOf(Objective const &objective) -> std::vector<Coordinates> {
+	return nlohmann::json(objective)["sequence"].get<std::vector<Coordinates>>();
+}
+
+auto sequenceOf(EmbeddedObjective const &embedded) -> std::vector<Coordinates> {
+	auto const first = std::next(cbegin(EMBEDDED_WAYPOINTS), embedded.firstWaypoint);
+	return std::vector<Coordinates>(first, std::next(first, embedded.numberOfWaypoints));
+}
+
+auto assertHasEmbeddedObjectives(ObjectiveManager const &manager) {
+	for (auto const &embedded : EMBEDDED_OBJECTIVES) {
+		auto const &objective = manager.getObjective(embedded.id);
+		ASSERT_EQUAL(embedded.absolute, objective.isAbsolute());
+		ASSERT_EQUAL(Coordinates{embedded.origin}, objective.getOrigin().getCoordinates());
+		ASSERT_EQUAL(sequenceOf(embedded), sequenceOf(objective));
+	}
+}
+
+} // namespace
+
+void testEmbeddedObjectivesAreLoadedWithoutAnObjectivesFile() {
+	assertHasEmbeddedObjectives(ObjectiveManager{logger});
+}
+
+void testEmptyObjectivesFileKeepsTheEmbeddedObjectives() {
+	auto input = std::istringstream{};
+	assertHasEmbeddedObjectives(ObjectiveManager{input, logger});
+}
+
+void testObjectivesFileReplacesTheEmbeddedObjective() {
+	auto input = std::istringstream{nlohmann::json::array({makeObjective(replacedId, {firstWaypoint})}).dump()};
+	auto const manager = ObjectiveManager{input, logger};
+
+	ASSERT_EQUAL(std::vector{firstWaypoint}, sequenceOf(manager.getObjective(replacedId)));
+}
+
+void testLaterObjectiveInTheObjectivesFileReplacesTheEarlierOne() {
+	auto const first = makeObjective(replacedId, {firstWaypoint});
+	auto const second = makeObjective(replacedId, {secondWaypoint});
+	auto input = std::istringstream{nlohmann::json::array({first, second}).dump()};
+	auto const manager = ObjectiveManager{input, logger};
+
+	ASSERT_EQUAL(std::vector{secondWaypoint}, sequenceOf(manager.getObjective(replacedId)));
+}
+
+void testEmbeddedWaypointsAreWithinTheWaypointTable() {
+	for (auto const &embedded : EMBEDDED_OBJECTIVES) {
+		ASSERT_LESS_EQUAL(embedded.firstWaypoint + embedded.numberOfWaypoints, EMBEDDED_WAYPOINTS.size());
+	}
+}
+
+cute::suite make_suite_ObjectiveManagerSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testEmbeddedObjectivesAreLoadedWithoutAnObjectivesFile));
+	s.push_back(CUTE(testEmptyObjectivesFileKeepsTheEmbeddedObjectives));
+	s.push_back(CUTE(testObjectivesFileReplacesTheEmbeddedObjective));
+	s.push_back(CUTE(testLaterObjectiveInTheObjectivesFileReplacesTheEarlierOne));
+	s.push_back(CUTE(testEmbeddedWaypointsAreWithinTheWaypointTable));
+	return s;
+}
@@ -0,0 +1,112 @@
+#include "ObjectiveSuite.h"
+
+#include "control/Objective.h"
+#include "hw/Coordinates.h"
+#include "math/Matrix.h"
+#include "support/Logging.h"
+
+#include <cute/cute.h>
+#include <nlohmann/json.hpp>
+
+#include <optional>
+#include <vector>
+
+using KinovaZED::coordTransform;
+using KinovaZED::Control::Objective;
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::Origin;
+
+namespace {
+
+auto const logger = KinovaZED::makeLogger({"ObjectiveSuite", {}, {}, {}});
+
+Coordinates const openDoorOrigin{0.212972, -0.271539, 0.491391, 1.545, 1.047, 0.062};
+Coordinates const firstWaypoint{-0.003, 0.008, 0, -0.027, -0.008, 0.713};
+Coordinates const secondWaypoint{-0.033, 0.015, -0.197, -0.06, 0.192, 0.598};
+
+auto makeObjective(bool absolute, Coordinates const &origin, std::vector<Coordinates> const &sequence) -> Objective {
+	return {{{"name", "OpenDoor"}, {"origin", origin}, {"sequence", sequence}, {"is_abs", absolute}}, logger};
+}
+
+auto transformed(Coordinates const &waypoint, Coordinates const &origin) -> Coordinates {
+	return coordTransform(waypoint, Origin{origin}.getTransformationMatrix()).value();
+}
+
+} // namespace
+
+void testNextPointYieldsTheWaypointsOfAnObjectiveWithoutOrigin() {
+	auto objective = makeObjective(true, {}, {firstWaypoint, secondWaypoint});
+
+	ASSERT_EQUAL(firstWaypoint, objective.nextPoint()->value());
+	ASSERT_EQUAL(secondWaypoint, objective.nextPoint()->value());
+}
+
+void testNextPointYieldsNothingAfterTheLastWaypoint() {
+	auto objective = makeObjective(true, {}, {firstWaypoint});
+	objective.nextPoint();
+
+	ASSERT(!objective.nextPoint());
+	ASSERT(!objective.nextPoint());
+}
+
+void testAbsoluteObjectiveIsTransformedWithItsLoadedOrigin() {
+	auto objective = makeObjective(true, openDoorOrigin, {firstWaypoint, secondWaypoint});
+
+	ASSERT_EQUAL(transformed(firstWaypoint, openDoorOrigin), objective.nextPoint()->value());
+	ASSERT_EQUAL(transformed(secondWaypoint, openDoorOrigin), objective.nextPoint()->value());
+}
+
+void testSetOriginTransformsTheWaypointsOfARelativeObjective() {
+	auto objective = makeObjective(false, {}, {firstWaypoint, secondWaypoint});
+	objective.setOrigin(openDoorOrigin);
+
+	ASSERT_EQUAL(transformed(firstWaypoint, openDoorOrigin), objective.nextPoint()->value());
+	ASSERT_EQUAL(transformed(secondWaypoint, openDoorOrigin), objective.nextPoint()->value());
+}
+
+void testSetOriginDuringASequenceAppliesToTheRemainingWaypoints() {
+	auto objective = makeObjective(false, {}, {firstWaypoint, secondWaypoint});
+	objective.nextPoint();
+	objective.setOrigin(openDoorOrigin);
+
+	ASSERT_EQUAL(transformed(secondWaypoint, openDoorOrigin), objective.nextPoint()->value());
+}
+
+void testCopiesKeepTheirOwnTransformedWaypoints() {
+	auto const loaded = makeObjective(false, {}, {firstWaypoint});
+	auto relocated = loaded;
+	relocated.setOrigin(openDoorOrigin);
+	auto untouched = loaded;
+
+	ASSERT_EQUAL(transformed(firstWaypoint, openDoorOrigin), relocated.nextPoint()->value());
+	ASSERT_EQUAL(firstWaypoint, untouched.nextPoint()->value());
+}
+
+void testUnreachableWaypointYieldsAnError() {
+	auto objective = makeObjective(true, {0.5, 0, 0, 0, 0, 0}, {{0.5, 0, 0, 0, 0, 0}, {-0.5, 0, 0, 0, 0, 0}});
+
+	auto const unreachable = objective.nextPoint();
+	ASSERT(unreachable && !*unreachable);
+	ASSERT_EQUAL((Coordinates{0, 0, 0, 0, 0, 0}), objective.nextPoint()->value());
+}
+
+void testObjectiveFromValuesMatchesObjectiveFromJson() {
+	auto const fromJson = makeObjective(true, openDoorOrigin, {firstWaypoint, secondWaypoint});
+	auto const fromValues =
+	    Objective{Objective::Id::OpenDoor, openDoorOrigin, {firstWaypoint, secondWaypoint}, true, logger};
+
+	ASSERT_EQUAL(nlohmann::json(fromJson), nlohmann::json(fromValues));
+}
+
+cute::suite make_suite_ObjectiveSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testNextPointYieldsTheWaypointsOfAnObjectiveWithoutOrigin));
+	s.push_back(CUTE(testNextPointYieldsNothingAfterTheLastWaypoint));
+	s.push_back(CUTE(testAbsoluteObjectiveIsTransformedWithItsLoadedOrigin));
+	s.push_back(CUTE(testSetOriginTransformsTheWaypointsOfARelativeObjective));
+	s.push_back(CUTE(testSetOriginDuringASequenceAppliesToTheRemainingWaypoints));
+	s.push_back(CUTE(testCopiesKeepTheirOwnTransformedWaypoints));
+	s.push_back(CUTE(testUnreachableWaypointYieldsAnError));
+	s.push_back(CUTE(testObjectiveFromValuesMatchesObjectiveFromJson));
+	return s;
+}
@@ -0,0 +1,165 @@
+#include "PoseSuite.h"
+
+#include "MatrixHelper.h"
+
+#include "hw/Coordinates.h"
+#include "hw/Origin.h"
+#include "math/Matrix.h"
+#include "math/Pose.h"
+
+#include <cute/cute.h>
+
+#include <array>
+#include <cmath>
+
+using KinovaZED::coordTransform;
+using KinovaZED::getEulerAngles;
+using KinovaZED::Pose;
+using KinovaZED::Quaternion;
+using KinovaZED::rotMatrix;
+using KinovaZED::Vec3;
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::Origin;
+
+namespace {
+
+auto constexpr exactHalfPi = 1.57079632679489661923f;
+
+Origin const openDoorOrigin{Coordinates{0.212972, -0.271539, 0.491391, 1.545, 1.047, 0.062}};
+
+auto assertComposedPoseMatchesCoordTransform(Coordinates const &coordinates) {
+	auto const expected = coordTransform(coordinates, openDoorOrigin.getTransformationMatrix()).value();
+	ASSERT_EQUAL(expected, (openDoorOrigin.getPose() * Pose::fromCoordinates(coordinates)).toCoordinates().value());
+}
+
+auto roundTrip(Coordinates const &coordinates) -> Coordinates {
+	return Pose::fromCoordinates(coordinates).toCoordinates().value();
+}
+
+auto rotationOf(Coordinates const &coordinates) -> KinovaZED::Mat3 {
+	auto const angles = std::array{coordinates.pitch, coordinates.yaw, coordinates.roll};
+	return rotMatrix(angles.data());
+}
+
+} // namespace
+
+void testTransformationMatrixMatchesEulerRotation() {
+	auto const &coordinates = openDoorOrigin.getCoordinates();
+	auto const rotation = rotationOf(coordinates);
+	auto const expected = KinovaZED::Mat4{{{rotation[0][0], rotation[0][1], rotation[0][2], coordinates.x},
+	                                       {rotation[1][0], rotation[1][1], rotation[1][2], coordinates.y},
+	                                       {rotation[2][0], rotation[2][1], rotation[2][2], coordinates.z},
+	                                       {0, 0, 0, 1}}};
+	assertMatrixEqual(expected, openDoorOrigin.getTransformationMatrix());
+}
+
+void testInvertedPoseMatrixMatchesInvertedTransformationMatrix() {
+	assertMatrixEqual(openDoorOrigin.getInvertedTransformationMatrix(), openDoorOrigin.getInvertedPose().toMatrix());
+}
+
+void testQuaternionRotationMatchesRotationMatrix() {
+	auto const angles = Vec3{-0.06, 0.192, 0.598};
+	assertMatrixEqual(rotMatrix(angles.data()), Quaternion::fromEulerXYZ(angles).toMatrix());
+}
+
+void testComposedPosePosition1OfSequenceOpenDoor() {
+	assertComposedPoseMatchesCoordTransform({-0.003, 0.008, 0, -0.027, -0.008, 0.713});
+}
+
+void testComposedPosePosition2OfSequenceOpenDoor() {
+	assertComposedPoseMatchesCoordTransform({-0.033, 0.015, -0.197, -0.06, 0.192, 0.598});
+}
+
+void testComposedPosePosition3OfSequenceOpenDoor() {
+	assertComposedPoseMatchesCoordTransform({-0.063, 0, -0.19, -0.059, 0.069, -1.543});
+}
+
+void testComposedPosePosition4OfSequenceOpenDoor() {
+	assertComposedPoseMatchesCoordTransform({-0.07, 0.083, -0.188, -0.053, 0.055, -1.555});
+}
+
+void testComposedPosePosition5OfSequenceOpenDoor() {
+	assertComposedPoseMatchesCoordTransform({0.171, 0.03, -0.319, -0.006, 0.614, -0.106});
+}
+
+void testComposedPosePosition6OfSequenceOpenDoor() {
+	assertComposedPoseMatchesCoordTransform({0.163, -0.191, -0.039, 0.023, 0.216, -0.125});
+}
+
+void testInversePoseUndoesComposition() {
+	Coordinates const point{0.163, -0.191, -0.039, 0.023, 0.216, -0.125};
+	auto const composed = openDoorOrigin.getPose() * Pose::fromCoordinates(point);
+	ASSERT_EQUAL(point, (openDoorOrigin.getInvertedPose() * composed).toCoordinates().value());
+}
+
+void testComposingWithTheIdentityKeepsThePose() {
+	Coordinates const point{0.171, 0.03, -0.319, -0.006, 0.614, -0.106};
+	ASSERT_EQUAL(point, (Pose{} * Pose::fromCoordinates(point)).toCoordinates().value());
+}
+
+void testRoundTripAwayFromTheSingularity() {
+	Coordinates const point{0.1, 0.2, 0.3, 0.4, -1.2, 2.9};
+	ASSERT_EQUAL(point, roundTrip(point));
+}
+
+void testRoundTripAtPositiveSingularityYieldsExactHalfPi() {
+	auto const result = roundTrip({0.1, 0.2, 0.3, 0.4, exactHalfPi, 0});
+	ASSERT_EQUAL(exactHalfPi, result.yaw);
+	ASSERT_EQUAL(0.0f, result.roll);
+	ASSERT_EQUAL_DELTA(0.4f, result.pitch, epsilon);
+}
+
+void testRoundTripAtNegativeSingularityYieldsExactHalfPi() {
+	auto const result = roundTrip({0.1, 0.2, 0.3, 0.4, -exactHalfPi, 0});
+	ASSERT_EQUAL(-exactHalfPi, result.yaw);
+	ASSERT_EQUAL(0.0f, result.roll);
+	ASSERT_EQUAL_DELTA(0.4f, result.pitch, epsilon);
+}
+
+void testRoundTripAtSingularityKeepsTheRotation() {
+	Coordinates const point{0.1, 0.2, 0.3, 0.4, exactHalfPi, -0.7};
+	assertMatrixEqual(rotationOf(point), rotationOf(roundTrip(point)));
+}
+
+void testRoundTripCloseToSingularityKeepsTheAngles() {
+	Coordinates const point{0.1, 0.2, 0.3, 0.4, exactHalfPi - 0.001f, -0.7};
+	auto const result = roundTrip(point);
+	ASSERT_EQUAL_DELTA(point.pitch, result.pitch, 0.0001f);
+	ASSERT_EQUAL_DELTA(point.yaw, result.yaw, epsilon);
+	ASSERT_EQUAL_DELTA(point.roll, result.roll, 0.0001f);
+}
+
+void testRoundTripCloseToSingularityIsMoreAccurateThanTheMatrixPath() {
+	Coordinates const point{0.1, 0.2, 0.3, 0.4, exactHalfPi - 0.0005f, -0.7};
+	auto const viaMatrix = getEulerAngles(rotationOf(point));
+	auto const viaQuaternion = roundTrip(point);
+	ASSERT_LESS(std::fabs(viaQuaternion.yaw - point.yaw), std::fabs(viaMatrix[1] - point.yaw));
+}
+
+void testRoundTripVeryCloseToSingularityKeepsTheRotation() {
+	Coordinates const point{0.1, 0.2, 0.3, 0.4, exactHalfPi - 0.00001f, -0.7};
+	assertMatrixEqual(rotationOf(point), rotationOf(roundTrip(point)));
+}
+
+cute::suite make_suite_PoseSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testTransformationMatrixMatchesEulerRotation));
+	s.push_back(CUTE(testInvertedPoseMatrixMatchesInvertedTransformationMatrix));
+	s.push_back(CUTE(testQuaternionRotationMatchesRotationMatrix));
+	s.push_back(CUTE(testComposedPosePosition1OfSequenceOpenDoor));
+	s.push_back(CUTE(testComposedPosePosition2OfSequenceOpenDoor));
+	s.push_back(CUTE(testComposedPosePosition3OfSequenceOpenDoor));
+	s.push_back(CUTE(testComposedPosePosition4OfSequenceOpenDoor));
+	s.push_back(CUTE(testComposedPosePosition5OfSequenceOpenDoor));
+	s.push_back(CUTE(testComposedPosePosition6OfSequenceOpenDoor));
+	s.push_back(CUTE(testInversePoseUndoesComposition));
+	s.push_back(CUTE(testComposingWithTheIdentityKeepsThePose));
+	s.push_back(CUTE(testRoundTripAwayFromTheSingularity));
+	s.push_back(CUTE(testRoundTripAtPositiveSingularityYieldsExactHalfPi));
+	s.push_back(CUTE(testRoundTripAtNegativeSingularityYieldsExactHalfPi));
+	s.push_back(CUTE(testRoundTripAtSingularityKeepsTheRotation));
+	s.push_back(CUTE(testRoundTripCloseToSingularityKeepsTheAngles));
+	s.push_back(CUTE(testRoundTripCloseToSingularityIsMoreAccurateThanTheMatrixPath));
+	s.push_back(CUTE(testRoundTripVeryCloseToSingularityKeepsTheRotation));
+	return s;
+}
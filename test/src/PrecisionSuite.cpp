@@ -0,0 +1,175 @@
+#include "PrecisionSuite.h"
+
+#include "MatrixHelper.h"
+
+#include "hw/Coordinates.h"
+#include "hw/Origin.h"
+#include "math/Matrix.h"
+#include "math/Pose.h"
+
+#include <cute/cute.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+using KinovaZED::BasicPose;
+using KinovaZED::Matrix;
+using KinovaZED::Vector;
+using KinovaZED::Hw::BasicOrigin;
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::Origin;
+
+namespace {
+
+auto constexpr chainLength = std::size_t{1000};
+
+Coordinates const openDoorOrigin{0.212972, -0.271539, 0.491391, 1.545, 1.047, 0.062};
+Coordinates const step{0.0002, -0.0003, 0.0001, 0.011, -0.023, 0.017};
+
+/**
+ * Compose the step chainLength times onto the origin, as a chain of relative objectives does
+ */
+template<typename ScalarType>
+auto chain() -> BasicPose<ScalarType> {
+	auto const increment = BasicPose<ScalarType>::fromCoordinates(step);
+	auto pose = BasicPose<ScalarType>::fromCoordinates(openDoorOrigin);
+	for (auto index = std::size_t{}; index < chainLength; ++index) {
+		pose = pose * increment;
+	}
+	return pose;
+}
+
+/**
+ * Compose the step chainLength times onto the origin, rounding to coordinates after every step like setOrigin does
+ */
+auto chainThroughCoordinates() -> Coordinates {
+	auto position = openDoorOrigin;
+	for (auto index = std::size_t{}; index < chainLength; ++index) {
+		position = (Origin{position}.getPose() * BasicPose<float>::fromCoordinates(step)).toCoordinates().value();
+	}
+	return position;
+}
+
+/**
+ * The largest difference between the position and rotation of a pose and the reference pose
+ */
+template<typename ScalarType>
+auto errorOf(BasicPose<ScalarType> const &pose, BasicPose<long double> const &reference) -> long double {
+	auto const &[w, x, y, z] = pose.rotation;
+	auto const &expected = reference.rotation;
+	auto const differences = std::array{std::fabs(pose.translation[0] - reference.translation[0]),
+	                                    std::fabs(pose.translation[1] - reference.translation[1]),
+	                                    std::fabs(pose.translation[2] - reference.translation[2]),
+	                                    std::fabs(w - expected.w),
+	                                    std::fabs(x - expected.x),
+	                                    std::fabs(y - expected.y),
+	                                    std::fabs(z - expected.z)};
+	return *std::max_element(cbegin(differences), cend(differences));
+}
+
+template<typename ScalarType>
+auto errorOf(Matrix<4, 4, ScalarType> const &matrix, Matrix<4, 4, long double> const &reference) -> long double {
+	auto error = 0.0L;
+	for (auto row = std::size_t{}; row < 4; ++row) {
+		for (auto column = std::size_t{}; column < 4; ++column) {
+			error = std::max(error, std::fabs(matrix[row][column] - reference[row][column]));
+		}
+	}
+	return error;
+}
+
+template<typename ScalarType>
+auto chainedMatrix() -> Matrix<4, 4, ScalarType> {
+	auto const increment = BasicPose<ScalarType>::fromCoordinates(step).toMatrix();
+	auto matrix = BasicPose<ScalarType>::fromCoordinates(openDoorOrigin).toMatrix();
+	for (auto index = std::size_t{}; index < chainLength; ++index) {
+		matrix = KinovaZED::Kernels::compose(matrix, increment);
+	}
+	return matrix;
+}
+
+} // namespace
+
+void testDoubleRotationMatchesFloatRotation() {
+	auto const angles = Vector<3, double>{-0.06, 0.192, 0.598};
+	auto const rotation = KinovaZED::rotMatrix(angles.data());
+	auto const anglesAsFloat = KinovaZED::Vec3{-0.06f, 0.192f, 0.598f};
+	auto const expected = KinovaZED::rotMatrix(anglesAsFloat.data());
+	for (auto row = std::size_t{}; row < 3; ++row) {
+		for (auto column = std::size_t{}; column < 3; ++column) {
+			ASSERT_EQUAL_DELTA(expected[row][column], rotation[row][column], epsilon);
+		}
+	}
+}
+
+void testDoubleOriginMatchesFloatOrigin() {
+	auto const precise = BasicOrigin<double>{openDoorOrigin};
+	auto const origin = Origin{openDoorOrigin};
+	for (auto row = std::size_t{}; row < 4; ++row) {
+		for (auto column = std::size_t{}; column < 4; ++column) {
+			ASSERT_EQUAL_DELTA(origin.getTransformationMatrix()[row][column],
+			                   precise.getTransformationMatrix()[row][column],
+			                   epsilon);
+			ASSERT_EQUAL_DELTA(origin.getInvertedTransformationMatrix()[row][column],
+			                   precise.getInvertedTransformationMatrix()[row][column],
+			                   epsilon);
+		}
+	}
+}
+
+void testDoubleCoordTransformMatchesFloatCoordTransform() {
+	Coordinates const waypoint{-0.033, 0.015, -0.197, -0.06, 0.192, 0.598};
+	auto const expected = KinovaZED::coordTransform(waypoint, Origin{openDoorOrigin}.getTransformationMatrix());
+	auto const precise =
+	    KinovaZED::coordTransform(waypoint, BasicOrigin<double>{openDoorOrigin}.getTransformationMatrix());
+	ASSERT_EQUAL(expected.value(), precise.value());
+}
+
+void testDoubleDecodesToTheSameCoordinatesAsFloat() {
+	Coordinates const point{0.163, -0.191, -0.039, 0.023, 0.216, -0.125};
+	ASSERT_EQUAL(BasicPose<float>::fromCoordinates(point).toCoordinates().value(),
+	             BasicPose<double>::fromCoordinates(point).toCoordinates().value());
+}
+
+void testChainedDoublePosesAccumulateLessErrorThanFloatPoses() {
+	auto const reference = chain<long double>();
+	auto const floatError = errorOf(chain<float>(), reference);
+	auto const doubleError = errorOf(chain<double>(), reference);
+	ASSERT_LESS(doubleError, floatError);
+	ASSERT_LESS(doubleError, 1e-12L);
+	ASSERT_LESS(floatError, 1e-4L);
+}
+
+void testChainedDoubleMatricesAccumulateLessErrorThanFloatMatrices() {
+	auto const reference = chainedMatrix<long double>();
+	auto const floatError = errorOf(chainedMatrix<float>(), reference);
+	auto const doubleError = errorOf(chainedMatrix<double>(), reference);
+	ASSERT_LESS(doubleError, floatError);
+	ASSERT_LESS(doubleError, 1e-12L);
+	ASSERT_LESS(floatError, 1e-4L);
+}
+
+void testChainingThroughCoordinatesStaysCloseToTheDoubleChain() {
+	auto const precise = chain<double>().toCoordinates().value();
+	auto const rounded = chainThroughCoordinates();
+	ASSERT_EQUAL_DELTA(precise.x, rounded.x, 1e-4f);
+	ASSERT_EQUAL_DELTA(precise.y, rounded.y, 1e-4f);
+	ASSERT_EQUAL_DELTA(precise.z, rounded.z, 1e-4f);
+	ASSERT_EQUAL_DELTA(precise.pitch, rounded.pitch, 1e-3f);
+	ASSERT_EQUAL_DELTA(precise.yaw, rounded.yaw, 1e-3f);
+	ASSERT_EQUAL_DELTA(precise.roll, rounded.roll, 1e-3f);
+}
+
+cute::suite make_suite_PrecisionSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testDoubleRotationMatchesFloatRotation));
+	s.push_back(CUTE(testDoubleOriginMatchesFloatOrigin));
+	s.push_back(CUTE(testDoubleCoordTransformMatchesFloatCoordTransform));
+	s.push_back(CUTE(testDoubleDecodesToTheSameCoordinatesAsFloat));
+	s.push_back(CUTE(testChainedDoublePosesAccumulateLessErrorThanFloatPoses));
+	s.push_back(CUTE(testChainedDoubleMatricesAccumulateLessErrorThanFloatMatrices));
+	s.push_back(CUTE(testChainingThroughCoordinatesStaysCloseToTheDoubleChain));
+	return s;
+}
@@ -0,0 +1,187 @@
+#include "ReconnectorSuite.h"
+
+#include "hw/Reconnector.h"
+
+#include <cute/cute.h>
+
+#include <asio/io_context.hpp>
+#include <asio/io_context_strand.hpp>
+#include <asio/post.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+using KinovaZED::Hw::ReconnectPolicy;
+using KinovaZED::Hw::Reconnector;
+
+namespace {
+
+auto fixedPolicy() -> ReconnectPolicy {
+	auto policy = ReconnectPolicy{};
+	policy.initialDelay = 100ms;
+	policy.maximumDelay = 5000ms;
+	policy.jitter = 0.0;
+	return policy;
+}
+
+struct ReconnectorFixture {
+	explicit ReconnectorFixture(std::size_t failingAttempts, std::size_t maximumAttempts = 0)
+	    : failingAttempts{failingAttempts} {
+		auto policy = ReconnectPolicy{};
+		policy.initialDelay = 1ms;
+		policy.maximumDelay = 4ms;
+		policy.jitter = 0.0;
+		policy.maximumAttempts = maximumAttempts;
+		reconnector.setPolicy(policy);
+	}
+
+	auto start() -> bool {
+		return reconnector.start(
+		    [this] {
+			    ++attempts;
+			    if (attempts <= failingAttempts) {
+				    throw std::runtime_error{"unreachable"};
+			    }
+		    },
+		    [this](auto attempt, auto const &) { failures.push_back(attempt); },
+		    [this](bool reconnected, auto attempts) { outcome = std::pair{reconnected, attempts}; });
+	}
+
+	asio::io_context ioContext{};
+	asio::io_context::strand strand{ioContext};
+	Reconnector reconnector{strand};
+	std::size_t failingAttempts;
+	std::size_t attempts{};
+	std::vector<std::size_t> failures{};
+	std::optional<std::pair<bool, std::size_t>> outcome{};
+};
+
+} // namespace
+
+void testDelayDoublesWithEveryFailedAttempt() {
+	auto random = std::minstd_rand{};
+	auto const policy = fixedPolicy();
+
+	ASSERT_EQUAL(100, policy.delayFor(0, random).count());
+	ASSERT_EQUAL(200, policy.delayFor(1, random).count());
+	ASSERT_EQUAL(400, policy.delayFor(2, random).count());
+	ASSERT_EQUAL(3200, policy.delayFor(5, random).count());
+}
+
+void testDelayIsCappedAtTheMaximum() {
+	auto random = std::minstd_rand{};
+	auto const policy = fixedPolicy();
+
+	ASSERT_EQUAL(5000, policy.delayFor(6, random).count());
+	ASSERT_EQUAL(5000, policy.delayFor(16, random).count());
+	ASSERT_EQUAL(5000, policy.delayFor(std::numeric_limits<std::size_t>::max(), random).count());
+}
+
+void testJitterOnlyShortensTheDelay() {
+	auto random = std::minstd_rand{42};
+	auto policy = fixedPolicy();
+	policy.jitter = 0.5;
+
+	for (auto attempt = std::size_t{}; attempt < 1000; ++attempt) {
+		auto const delay = policy.delayFor(attempt % 8, random);
+		auto const nominal = fixedPolicy().delayFor(attempt % 8, random);
+		ASSERT_LESS_EQUAL(delay.count(), nominal.count());
+		ASSERT_GREATER_EQUAL(delay.count(), nominal.count() / 2);
+	}
+}
+
+void testJitterIsClampedToTheUnitInterval() {
+	auto random = std::minstd_rand{42};
+	auto policy = fixedPolicy();
+
+	policy.jitter = -1.0;
+	ASSERT_EQUAL(100, policy.delayFor(0, random).count());
+
+	policy.jitter = 2.0;
+	for (auto attempt = 0; attempt < 1000; ++attempt) {
+		auto const delay = policy.delayFor(0, random);
+		ASSERT_LESS_EQUAL(delay.count(), 100);
+		ASSERT_GREATER_EQUAL(delay.count(), 0);
+	}
+}
+
+void testReconnectorRetriesUntilTheAttemptSucceeds() {
+	auto fixture = ReconnectorFixture{3};
+
+	ASSERT(fixture.start());
+	ASSERT(fixture.reconnector.isActive());
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL((std::vector<std::size_t>{1, 2, 3}), fixture.failures);
+	ASSERT_EQUAL((std::pair<bool, std::size_t>{true, 4}), *fixture.outcome);
+	ASSERT(!fixture.reconnector.isActive());
+}
+
+void testReconnectorGivesUpAfterTheMaximumAttempts() {
+	auto fixture = ReconnectorFixture{10, 3};
+
+	fixture.start();
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL(3, fixture.attempts);
+	ASSERT_EQUAL((std::pair<bool, std::size_t>{false, 3}), *fixture.outcome);
+	ASSERT(!fixture.reconnector.isActive());
+}
+
+void testReconnectorRecordsStatistics() {
+	auto fixture = ReconnectorFixture{2};
+
+	fixture.start();
+	fixture.ioContext.run();
+
+	auto const &statistics = fixture.reconnector.getStatistics();
+	ASSERT_EQUAL(3, statistics.attempts);
+	ASSERT_EQUAL(2, statistics.failedAttempts);
+	ASSERT_EQUAL(1, statistics.reconnects);
+	ASSERT(statistics.lastDowntime >= 1ms + 2ms);
+	ASSERT_EQUAL(statistics.lastDowntime.count(), statistics.totalDowntime.count());
+}
+
+void testReconnectorDoesNotStartTwice() {
+	auto fixture = ReconnectorFixture{0};
+
+	ASSERT(fixture.start());
+	ASSERT(!fixture.start());
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL(1, fixture.attempts);
+}
+
+void testStoppedReconnectorMakesNoFurtherAttempts() {
+	auto fixture = ReconnectorFixture{10};
+
+	fixture.start();
+	asio::post(fixture.strand, [&] { ASSERT_EQUAL(0, fixture.reconnector.stop()); });
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL(0, fixture.attempts);
+	ASSERT(!fixture.outcome);
+	ASSERT(!fixture.reconnector.isActive());
+}
+
+cute::suite make_suite_ReconnectorSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testDelayDoublesWithEveryFailedAttempt));
+	s.push_back(CUTE(testDelayIsCappedAtTheMaximum));
+	s.push_back(CUTE(testJitterOnlyShortensTheDelay));
+	s.push_back(CUTE(testJitterIsClampedToTheUnitInterval));
+	s.push_back(CUTE(testReconnectorRetriesUntilTheAttemptSucceeds));
+	s.push_back(CUTE(testReconnectorGivesUpAfterTheMaximumAttempts));
+	s.push_back(CUTE(testReconnectorRecordsStatistics));
+	s.push_back(CUTE(testReconnectorDoesNotStartTwice));
+	s.push_back(CUTE(testStoppedReconnectorMakesNoFurtherAttempts));
+	return s;
+}
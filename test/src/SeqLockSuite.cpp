@@ -0,0 +1,101 @@
+#include "SeqLockSuite.h"
+
+#include "support/SeqLock.h"
+
+#include <cute/cute.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+/**
+ * A payload that spans several words, so that a torn read mixes the words of different stores
+ */
+struct TestPayload {
+	std::uint64_t sequence{};
+	std::array<std::uint64_t, 5> copies{};
+	std::uint64_t checksum{};
+};
+
+auto makePayload(std::uint64_t sequence) -> TestPayload {
+	auto payload = TestPayload{sequence, {}, ~sequence};
+	payload.copies.fill(sequence);
+	return payload;
+}
+
+auto isConsistent(TestPayload const &payload) -> bool {
+	return payload.checksum == ~payload.sequence &&
+	    std::all_of(cbegin(payload.copies), cend(payload.copies), [&](auto copy) { return copy == payload.sequence; });
+}
+
+void testDefaultConstructedLockHoldsDefaultValue() {
+	auto const lock = KinovaZED::SeqLock<TestPayload>{};
+	auto const value = lock.load();
+	ASSERT_EQUAL(0, value.sequence);
+	ASSERT_EQUAL(0, value.checksum);
+}
+
+void testLoadReturnsLastStoredValue() {
+	auto lock = KinovaZED::SeqLock<TestPayload>{makePayload(1)};
+	lock.store(makePayload(42));
+	ASSERT_EQUAL(42, lock.load().sequence);
+	ASSERT(isConsistent(lock.load()));
+}
+
+void testVersionStartsAtOneAndIncreasesWithEveryStore() {
+	auto lock = KinovaZED::SeqLock<TestPayload>{};
+	ASSERT_EQUAL(1, lock.version());
+
+	lock.store(makePayload(7));
+	lock.store(makePayload(8));
+
+	auto version = std::uint64_t{};
+	auto const value = lock.load(&version);
+	ASSERT_EQUAL(3, version);
+	ASSERT_EQUAL(3, lock.version());
+	ASSERT_EQUAL(8, value.sequence);
+}
+
+void testConcurrentReadersNeverObserveTornOrStaleValues() {
+	auto lock = KinovaZED::SeqLock<TestPayload>{makePayload(0)};
+	auto done = std::atomic_bool{false};
+	auto stores = std::uint64_t{};
+
+	auto writer = std::thread{[&] {
+		while (!done.load(std::memory_order_relaxed)) {
+			lock.store(makePayload(++stores));
+		}
+	}};
+
+	auto consistent = true;
+	auto monotonic = true;
+	auto lastSequence = std::uint64_t{};
+	auto lastVersion = std::uint64_t{};
+
+	for (auto read = 0u; read < 5000000; ++read) {
+		auto version = std::uint64_t{};
+		auto const value = lock.load(&version);
+		consistent &= isConsistent(value);
+		consistent &= version == value.sequence + 1;
+		monotonic &= value.sequence >= lastSequence && version >= lastVersion;
+		lastSequence = value.sequence;
+		lastVersion = version;
+	}
+
+	done = true;
+	writer.join();
+	ASSERT(consistent);
+	ASSERT(monotonic);
+	ASSERT_EQUAL(stores, lock.load().sequence);
+}
+
+cute::suite make_suite_SeqLockSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testDefaultConstructedLockHoldsDefaultValue));
+	s.push_back(CUTE(testLoadReturnsLastStoredValue));
+	s.push_back(CUTE(testVersionStartsAtOneAndIncreasesWithEveryStore));
+	s.push_back(CUTE(testConcurrentReadersNeverObserveTornOrStaleValues));
+	return s;
+}
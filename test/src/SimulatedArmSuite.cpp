@@ -0,0 +1,262 @@
+#include "SimulatedArmSuite.h"
+
+#include "hw/Actor.h"
+#include "hw/Coordinates.h"
+#include "hw/SimulatedArm.h"
+#include "support/ExecutorPool.h"
+#include "support/Logging.h"
+
+#include <cute/cute.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+using KinovaZED::Hw::Actor;
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::ReconnectPolicy;
+using KinovaZED::Hw::SimulatedArm;
+using KinovaZED::Hw::SteeringMode;
+
+namespace {
+
+auto const logger = KinovaZED::makeLogger({"SimulatedArmSuite", {}, {}, {}});
+
+auto fastModel() -> SimulatedArm::Model {
+	auto model = SimulatedArm::Model{};
+	model.maximumSpeed = 20.0f;
+	model.maximumAngularSpeed = 60.0f;
+	model.steeringModeDelay = 20ms;
+	model.stepPeriod = 1ms;
+	model.latencies = SimulatedArm::TransactionLatencies{0us, 0us, 0us, 0us, 0us, 0us, 0us, 0us, 0us, 0us, 0us};
+	return model;
+}
+
+auto fastReconnectPolicy(std::size_t maximumAttempts = 0) -> ReconnectPolicy {
+	auto policy = ReconnectPolicy{};
+	policy.initialDelay = 5ms;
+	policy.maximumDelay = 20ms;
+	policy.jitter = 0.0;
+	policy.maximumAttempts = maximumAttempts;
+	return policy;
+}
+
+struct RecordingSubscriber : Actor::EventSubscriber {
+	auto onPositionReached(Actor &, Coordinates point) -> void override {
+		record("position reached", point);
+	}
+
+	auto onHomeReached(Actor &) -> void override {
+		record("home reached");
+	}
+
+	auto onRetractionPointReached(Actor &) -> void override {
+		record("retraction point reached");
+	}
+
+	auto onInitializationFinished(Actor &) -> void override {
+		record("initialization finished");
+	}
+
+	auto onReconnectedDueToError(Actor &) -> void override {
+		record("reconnected");
+	}
+
+	auto waitForEvents(std::size_t count) -> std::vector<std::string> {
+		auto lock = std::unique_lock{mutex};
+		eventArrived.wait_for(lock, 2s, [&] { return events.size() >= count; });
+		return events;
+	}
+
+	std::vector<Coordinates> positions{};
+
+  private:
+	auto record(std::string event, std::optional<Coordinates> point = std::nullopt) -> void {
+		auto lock = std::lock_guard{mutex};
+		events.push_back(std::move(event));
+		if (point) {
+			positions.push_back(*point);
+		}
+		eventArrived.notify_all();
+	}
+
+	std::mutex mutex{};
+	std::condition_variable eventArrived{};
+	std::vector<std::string> events{};
+};
+
+} // namespace
+
+void testSimulatedArmStartsRetracted() {
+	auto arm = SimulatedArm{fastModel(), logger};
+
+	ASSERT(arm.connect());
+	ASSERT_EQUAL(SimulatedArm::Model{}.retractionPoint, arm.getPosition());
+}
+
+void testInitializationEndsAtHardwareHome() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.connect();
+
+	arm.initialize();
+
+	ASSERT_EQUAL(std::vector<std::string>{"initialization finished"}, subscriber->waitForEvents(1));
+	ASSERT_EQUAL(SimulatedArm::Model{}.hardwareHome, arm.getPosition());
+}
+
+void testRetractionMovesHomeFirst() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.connect();
+	arm.initialize();
+	subscriber->waitForEvents(1);
+
+	arm.retract();
+
+	ASSERT_EQUAL((std::vector<std::string>{"initialization finished", "retraction point reached"}),
+	             subscriber->waitForEvents(2));
+	ASSERT_EQUAL(SimulatedArm::Model{}.retractionPoint, arm.getPosition());
+}
+
+void testAppendedTargetsAreReachedInOrder() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.connect();
+
+	auto const first = Coordinates{0.3f, -0.4f, 0.5f, 1.5f, 1.0f, 0.0f};
+	auto const second = Coordinates{-0.3f, -0.4f, 0.5f, 1.5f, 1.0f, 0.0f};
+	arm.moveTo(first);
+	arm.appendTarget(second);
+
+	ASSERT_EQUAL((std::vector<std::string>{"position reached", "position reached"}), subscriber->waitForEvents(2));
+	ASSERT(isInRange(first, subscriber->positions[0]));
+	ASSERT(isInRange(second, subscriber->positions[1]));
+}
+
+void testArmsCanShareASingleThread() {
+	auto executor = KinovaZED::ExecutorPool{1};
+	auto first = SimulatedArm{executor, fastModel(), logger};
+	auto second = SimulatedArm{executor, fastModel(), logger};
+	auto firstSubscriber = std::make_shared<RecordingSubscriber>();
+	auto secondSubscriber = std::make_shared<RecordingSubscriber>();
+	first.subscribe(firstSubscriber);
+	second.subscribe(secondSubscriber);
+	first.connect();
+	second.connect();
+
+	first.initialize();
+	second.initialize();
+
+	ASSERT_EQUAL(std::vector<std::string>{"initialization finished"}, firstSubscriber->waitForEvents(1));
+	ASSERT_EQUAL(std::vector<std::string>{"initialization finished"}, secondSubscriber->waitForEvents(1));
+}
+
+void testConnectionLossDropsControlAndSteeringMode() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	arm.connect();
+	arm.takeControl();
+	arm.setSteeringMode(SteeringMode::XYZ);
+
+	arm.simulateConnectionLoss();
+
+	ASSERT(arm.hasFailed());
+	ASSERT(!arm.getSteeringMode());
+}
+
+void testReconnectRestoresControlAndSteeringMode() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.setReconnectPolicy(fastReconnectPolicy());
+	arm.setShouldReconnectOnError(true);
+	arm.connect();
+	arm.takeControl();
+	arm.setSteeringMode(SteeringMode::XYZ);
+
+	arm.simulateConnectionLoss(2);
+	ASSERT(arm.hasFailed());
+	ASSERT(!arm.getSteeringMode());
+
+	ASSERT_EQUAL(std::vector<std::string>{"reconnected"}, subscriber->waitForEvents(1));
+	ASSERT(!arm.hasFailed());
+	ASSERT_EQUAL(SteeringMode::XYZ, arm.getSteeringMode().value_or(SteeringMode::NoMode));
+}
+
+void testReconnectWithoutControlDoesNotRestoreSteeringMode() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.setReconnectPolicy(fastReconnectPolicy());
+	arm.setShouldReconnectOnError(true);
+	arm.connect();
+	arm.setSteeringMode(SteeringMode::Rotation);
+
+	arm.simulateConnectionLoss(1);
+
+	ASSERT_EQUAL(std::vector<std::string>{"reconnected"}, subscriber->waitForEvents(1));
+	ASSERT(!arm.hasFailed());
+	ASSERT(!arm.getSteeringMode());
+}
+
+void testReconnectGivesUpAfterTheMaximumAttempts() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.setReconnectPolicy(fastReconnectPolicy(2));
+	arm.setShouldReconnectOnError(true);
+	arm.connect();
+
+	arm.simulateConnectionLoss(3);
+	std::this_thread::sleep_for(100ms);
+
+	ASSERT(arm.hasFailed());
+	ASSERT(subscriber->waitForEvents(0).empty());
+}
+
+void testHardOvercurrentShutsTheArmDown() {
+	auto arm = SimulatedArm{fastModel(), logger};
+	auto subscriber = std::make_shared<RecordingSubscriber>();
+	arm.subscribe(subscriber);
+	arm.setReconnectPolicy(fastReconnectPolicy());
+	arm.setShouldReconnectOnError(true);
+	arm.connect();
+	arm.takeControl();
+	arm.moveTo(Coordinates{0.6f, 0.6f, 0.9f, 1.5f, 1.0f, 0.0f});
+
+	arm.simulateJointCurrents({3.0f, 3.0f, 3.0f, 2.0f, 2.0f, 2.0f});
+	std::this_thread::sleep_for(50ms);
+
+	ASSERT(arm.hasFailed());
+	auto const stoppedAt = arm.getPosition();
+	std::this_thread::sleep_for(50ms);
+	ASSERT_EQUAL(stoppedAt, arm.getPosition());
+	ASSERT(arm.hasFailed());
+	ASSERT(subscriber->waitForEvents(0).empty());
+}
+
+cute::suite make_suite_SimulatedArmSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testSimulatedArmStartsRetracted));
+	s.push_back(CUTE(testInitializationEndsAtHardwareHome));
+	s.push_back(CUTE(testRetractionMovesHomeFirst));
+	s.push_back(CUTE(testAppendedTargetsAreReachedInOrder));
+	s.push_back(CUTE(testArmsCanShareASingleThread));
+	s.push_back(CUTE(testConnectionLossDropsControlAndSteeringMode));
+	s.push_back(CUTE(testReconnectRestoresControlAndSteeringMode));
+	s.push_back(CUTE(testReconnectWithoutControlDoesNotRestoreSteeringMode));
+	s.push_back(CUTE(testReconnectGivesUpAfterTheMaximumAttempts));
+	s.push_back(CUTE(testHardOvercurrentShutsTheArmDown));
+	return s;
+}
@@ -0,0 +1,144 @@
+#include "StepSequencerSuite.h"
+
+#include "hw/StepSequencer.h"
+
+#include <cute/cute.h>
+
+#include <asio/io_context.hpp>
+#include <asio/io_context_strand.hpp>
+#include <asio/post.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+using KinovaZED::Hw::StepSequencer;
+
+struct SequencerFixture {
+	asio::io_context ioContext{};
+	asio::io_context::strand strand{ioContext};
+	std::vector<std::string> failures{};
+	StepSequencer sequencer{strand, [this](auto const &step, auto const &) { failures.push_back(step); }};
+};
+
+void testStepsWithoutSettleTimeRunImmediately() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+
+	fixture.sequencer.append("first", [&] { executed.push_back("first"); });
+	fixture.sequencer.append("second", [&] { executed.push_back("second"); });
+
+	ASSERT_EQUAL((std::vector<std::string>{"first", "second"}), executed);
+	ASSERT(fixture.sequencer.isIdle());
+}
+
+void testSettleTimeDefersFollowingSteps() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+
+	fixture.sequencer.append("push", [&] { executed.push_back("push"); }, 20ms);
+	fixture.sequencer.append("release", [&] { executed.push_back("release"); });
+
+	ASSERT_EQUAL(std::vector<std::string>{"push"}, executed);
+	ASSERT(!fixture.sequencer.isIdle());
+
+	auto const start = std::chrono::steady_clock::now();
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL((std::vector<std::string>{"push", "release"}), executed);
+	ASSERT(std::chrono::steady_clock::now() - start >= 20ms);
+}
+
+void testCompletionIsNotifiedAfterAllStepsOfTheBatch() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+	auto result = std::optional<bool>{};
+
+	fixture.sequencer.append("push", [&] { executed.push_back("push"); }, 10ms);
+	fixture.sequencer.wait(10ms);
+	fixture.sequencer.notify([&](bool succeeded) {
+		ASSERT_EQUAL(1, executed.size());
+		result = succeeded;
+	});
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL(std::optional{true}, result);
+}
+
+void testFailingStepSkipsTheRestOfItsBatch() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+	auto results = std::vector<bool>{};
+
+	fixture.sequencer.append("fail", [] { throw std::runtime_error{"USB transfer failed"}; });
+	fixture.sequencer.append("skipped", [&] { executed.push_back("skipped"); });
+	fixture.sequencer.notify([&](bool succeeded) { results.push_back(succeeded); });
+	fixture.sequencer.append("next", [&] { executed.push_back("next"); });
+	fixture.sequencer.notify([&](bool succeeded) { results.push_back(succeeded); });
+
+	ASSERT_EQUAL(std::vector<std::string>{"fail"}, fixture.failures);
+	ASSERT_EQUAL(std::vector<std::string>{"next"}, executed);
+	ASSERT_EQUAL((std::vector<bool>{false, true}), results);
+}
+
+void testCancelDropsPendingSteps() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+	auto result = std::optional<bool>{};
+
+	fixture.sequencer.append("push", [&] { executed.push_back("push"); }, 1000ms);
+	fixture.sequencer.append("release", [&] { executed.push_back("release"); });
+	fixture.sequencer.notify([&](bool succeeded) { result = succeeded; });
+
+	ASSERT_EQUAL(1, fixture.sequencer.cancel());
+	ASSERT(fixture.sequencer.isIdle());
+	ASSERT_EQUAL(std::optional{false}, result);
+
+	auto const start = std::chrono::steady_clock::now();
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL(std::vector<std::string>{"push"}, executed);
+	ASSERT(std::chrono::steady_clock::now() - start < 1000ms);
+}
+
+void testSequencerIsUsableAfterCancel() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+
+	fixture.sequencer.append("push", [&] { executed.push_back("push"); }, 1000ms);
+	fixture.sequencer.cancel();
+	fixture.sequencer.append("stop", [&] { executed.push_back("stop"); }, 10ms);
+	fixture.sequencer.append("release", [&] { executed.push_back("release"); });
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL((std::vector<std::string>{"push", "stop", "release"}), executed);
+}
+
+void testStrandStaysResponsiveWhileSettling() {
+	auto fixture = SequencerFixture{};
+	auto executed = std::vector<std::string>{};
+
+	fixture.sequencer.append("push", [&] { executed.push_back("push"); }, 50ms);
+	fixture.sequencer.append("release", [&] { executed.push_back("release"); });
+	asio::post(fixture.strand, [&] { executed.push_back("state update"); });
+	fixture.ioContext.run();
+
+	ASSERT_EQUAL((std::vector<std::string>{"push", "state update", "release"}), executed);
+}
+
+cute::suite make_suite_StepSequencerSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testStepsWithoutSettleTimeRunImmediately));
+	s.push_back(CUTE(testSettleTimeDefersFollowingSteps));
+	s.push_back(CUTE(testCompletionIsNotifiedAfterAllStepsOfTheBatch));
+	s.push_back(CUTE(testFailingStepSkipsTheRestOfItsBatch));
+	s.push_back(CUTE(testCancelDropsPendingSteps));
+	s.push_back(CUTE(testSequencerIsUsableAfterCancel));
+	s.push_back(CUTE(testStrandStaysResponsiveWhileSettling));
+	return s;
+}
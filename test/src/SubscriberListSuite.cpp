@@ -0,0 +1,127 @@
+#include "SubscriberListSuite.h"
+
+#include "support/SubscriberList.h"
+
+#include <cute/cute.h>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+
+using KinovaZED::SubscriberList;
+
+namespace {
+
+struct CountingSubscriber {
+	auto notify() -> void {
+		++notifications;
+	}
+
+	std::atomic<std::size_t> notifications{};
+};
+
+} // namespace
+
+void testSubscribersAreOnlyAddedOnce() {
+	auto list = SubscriberList<CountingSubscriber>{};
+	auto subscriber = std::make_shared<CountingSubscriber>();
+
+	ASSERT(list.add(subscriber));
+	ASSERT(!list.add(subscriber));
+	ASSERT_EQUAL(1, list.size());
+}
+
+void testOnlyKnownSubscribersCanBeRemoved() {
+	auto list = SubscriberList<CountingSubscriber>{};
+	auto subscriber = std::make_shared<CountingSubscriber>();
+	list.add(subscriber);
+
+	ASSERT(!list.remove(std::make_shared<CountingSubscriber>()));
+	ASSERT(list.remove(subscriber));
+	ASSERT(!list.remove(subscriber));
+	ASSERT_EQUAL(0, list.size());
+}
+
+void testEverySubscriberIsNotified() {
+	auto list = SubscriberList<CountingSubscriber>{};
+	auto subscribers = std::vector<std::shared_ptr<CountingSubscriber>>{};
+	for (auto index = 0; index < 8; ++index) {
+		subscribers.push_back(std::make_shared<CountingSubscriber>());
+		list.add(subscribers.back());
+	}
+
+	list.forEach([](auto &subscriber) { subscriber.notify(); });
+
+	for (auto const &subscriber : subscribers) {
+		ASSERT_EQUAL(1, subscriber->notifications);
+	}
+}
+
+void testSnapshotIsNotAffectedByLaterChanges() {
+	auto list = SubscriberList<CountingSubscriber>{};
+	auto first = std::make_shared<CountingSubscriber>();
+	list.add(first);
+
+	auto snapshot = list.snapshot();
+	list.add(std::make_shared<CountingSubscriber>());
+	list.remove(first);
+
+	ASSERT_EQUAL(1, snapshot->size());
+	ASSERT_EQUAL(first, snapshot->front());
+	ASSERT_EQUAL(1, list.size());
+}
+
+void testSubscribersCanBeRemovedWhileNotifying() {
+	auto list = SubscriberList<CountingSubscriber>{};
+	auto first = std::make_shared<CountingSubscriber>();
+	auto second = std::make_shared<CountingSubscriber>();
+	list.add(first);
+	list.add(second);
+
+	list.forEach([&](auto &subscriber) {
+		list.remove(first);
+		list.remove(second);
+		subscriber.notify();
+	});
+
+	ASSERT_EQUAL(1, first->notifications);
+	ASSERT_EQUAL(1, second->notifications);
+	ASSERT_EQUAL(0, list.size());
+}
+
+void testSubscribersCanBeAddedFromAnotherThread() {
+	auto list = SubscriberList<CountingSubscriber>{};
+	auto subscribers = std::vector<std::shared_ptr<CountingSubscriber>>(256);
+	for (auto &subscriber : subscribers) {
+		subscriber = std::make_shared<CountingSubscriber>();
+	}
+
+	auto adder = std::async(std::launch::async, [&] {
+		for (auto const &subscriber : subscribers) {
+			list.add(subscriber);
+		}
+	});
+
+	while (list.size() < subscribers.size()) {
+		list.forEach([](auto &subscriber) { subscriber.notify(); });
+	}
+	adder.get();
+
+	list.forEach([](auto &subscriber) { subscriber.notify(); });
+	for (auto const &subscriber : subscribers) {
+		ASSERT(subscriber->notifications >= 1);
+	}
+}
+
+cute::suite make_suite_SubscriberListSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testSubscribersAreOnlyAddedOnce));
+	s.push_back(CUTE(testOnlyKnownSubscribersCanBeRemoved));
+	s.push_back(CUTE(testEverySubscriberIsNotified));
+	s.push_back(CUTE(testSnapshotIsNotAffectedByLaterChanges));
+	s.push_back(CUTE(testSubscribersCanBeRemovedWhileNotifying));
+	s.push_back(CUTE(testSubscribersCanBeAddedFromAnotherThread));
+	return s;
+}
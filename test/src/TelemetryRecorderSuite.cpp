@@ -0,0 +1,164 @@
+#include "TelemetryRecorderSuite.h"
+
+#include "hw/Coordinates.h"
+#include "hw/TelemetryRecorder.h"
+
+#include <cute/cute.h>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using KinovaZED::Hw::Coordinates;
+using KinovaZED::Hw::TelemetryRecord;
+using KinovaZED::Hw::TelemetryRecorder;
+
+namespace {
+
+/**
+ * A telemetry file in the temporary directory that is removed once the test is done
+ */
+struct TemporaryFile {
+	TemporaryFile()
+	    : path{std::filesystem::temp_directory_path() /
+	           ("kinovazed-telemetry-" + std::to_string(::getpid()) + "-" + std::to_string(counter++) + ".bin")} {
+	}
+
+	~TemporaryFile() {
+		std::filesystem::remove(path);
+	}
+
+	std::filesystem::path const path;
+
+  private:
+	static inline std::size_t counter{};
+};
+
+auto makeSample(float x) -> TelemetryRecorder::Sample {
+	auto sample = TelemetryRecorder::Sample{};
+	sample.position = Coordinates{x, 0.1f, 0.2f, 1.0f, 1.1f, 1.2f};
+	sample.jointCurrents = {0.5f, 0.6f, 0.7f, 0.8f, 0.9f, 1.0f};
+	sample.retractionMode = 5;
+	sample.hasControl = true;
+	return sample;
+}
+
+} // namespace
+
+void testRecordedSamplesCanBeReadBack() {
+	auto file = TemporaryFile{};
+	{
+		auto recorder = TelemetryRecorder{file.path, 16};
+		recorder.setControllerState(0x14);
+		recorder.record(makeSample(0.1f));
+		recorder.record(makeSample(0.2f));
+	}
+
+	auto records = KinovaZED::Hw::readTelemetryFile(file.path);
+
+	ASSERT_EQUAL(2, records.size());
+	ASSERT_EQUAL(1, records[0].sequence);
+	ASSERT_EQUAL(0.2f, records[1].position[0]);
+	ASSERT_EQUAL(0.9f, records[1].jointCurrents[4]);
+	ASSERT_EQUAL(5, records[1].retractionMode);
+	ASSERT_EQUAL(TelemetryRecord::unknown, records[1].movementStatus);
+	ASSERT_EQUAL(0x14, records[1].controllerState);
+	ASSERT_EQUAL(TelemetryRecord::HasControl, records[1].flags);
+	ASSERT(records[0].timestamp <= records[1].timestamp);
+}
+
+void testOldestSamplesAreOverwrittenOnceTheRingIsFull() {
+	auto file = TemporaryFile{};
+	{
+		auto recorder = TelemetryRecorder{file.path, 4};
+		for (auto index = 0; index < 10; ++index) {
+			recorder.record(makeSample(index * 0.01f));
+		}
+	}
+
+	auto records = KinovaZED::Hw::readTelemetryFile(file.path);
+
+	ASSERT_EQUAL(4, records.size());
+	ASSERT_EQUAL(7, records.front().sequence);
+	ASSERT_EQUAL(10, records.back().sequence);
+	ASSERT_EQUAL(sizeof(TelemetryRecord) * 4 + 64, std::filesystem::file_size(file.path));
+}
+
+void testRecordingResumesAfterReopening() {
+	auto file = TemporaryFile{};
+	{
+		auto recorder = TelemetryRecorder{file.path, 4};
+		for (auto index = 0; index < 6; ++index) {
+			recorder.record(makeSample(0.1f));
+		}
+	}
+
+	auto recorder = TelemetryRecorder{file.path, 4};
+	ASSERT_EQUAL(7, recorder.nextSequence());
+	recorder.record(makeSample(0.3f));
+	recorder.flush();
+
+	auto records = KinovaZED::Hw::readTelemetryFile(file.path);
+
+	ASSERT_EQUAL(4, records.size());
+	ASSERT_EQUAL(4, records.front().sequence);
+	ASSERT_EQUAL(0.3f, records.back().position[0]);
+}
+
+void testReopeningWithDifferentCapacityStartsOver() {
+	auto file = TemporaryFile{};
+	{
+		auto recorder = TelemetryRecorder{file.path, 4};
+		recorder.record(makeSample(0.1f));
+	}
+
+	auto recorder = TelemetryRecorder{file.path, 8};
+
+	ASSERT_EQUAL(1, recorder.nextSequence());
+	ASSERT(KinovaZED::Hw::readTelemetryFile(file.path).empty());
+}
+
+void testCorruptedRecordsAreSkipped() {
+	auto file = TemporaryFile{};
+	{
+		auto recorder = TelemetryRecorder{file.path, 4};
+		for (auto index = 0; index < 3; ++index) {
+			recorder.record(makeSample(0.1f));
+		}
+	}
+
+	{
+		auto stream = std::fstream{file.path, std::ios::in | std::ios::out | std::ios::binary};
+		stream.seekp(64 + 2 * sizeof(TelemetryRecord) + 20);
+		stream.put('\x7f');
+	}
+
+	auto records = KinovaZED::Hw::readTelemetryFile(file.path);
+
+	ASSERT_EQUAL(2, records.size());
+	ASSERT_EQUAL(1, records[0].sequence);
+	ASSERT_EQUAL(3, records[1].sequence);
+}
+
+void testForeignFilesAreRejected() {
+	auto file = TemporaryFile{};
+	std::ofstream{file.path} << "definitely not telemetry, but long enough to hold a header of sixty-four bytes";
+
+	ASSERT_THROWS(KinovaZED::Hw::readTelemetryFile(file.path), std::runtime_error);
+}
+
+cute::suite make_suite_TelemetryRecorderSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testRecordedSamplesCanBeReadBack));
+	s.push_back(CUTE(testOldestSamplesAreOverwrittenOnceTheRingIsFull));
+	s.push_back(CUTE(testRecordingResumesAfterReopening));
+	s.push_back(CUTE(testReopeningWithDifferentCapacityStartsOver));
+	s.push_back(CUTE(testCorruptedRecordsAreSkipped));
+	s.push_back(CUTE(testForeignFilesAreRejected));
+	return s;
+}
@@ -0,0 +1,64 @@
+#include "TransactionStatisticsSuite.h"
+
+#include "hw/TransactionStatistics.h"
+
+#include <cute/cute.h>
+
+#include <chrono>
+#include <string>
+
+using namespace std::chrono_literals;
+
+using KinovaZED::Hw::Transaction;
+using KinovaZED::Hw::TransactionStatistics;
+
+void testTransactionsAreCountedPerKind() {
+	auto statistics = TransactionStatistics{};
+	statistics.record(Transaction::GetCartesianPosition, 800us, false);
+	statistics.record(Transaction::GetCartesianPosition, 1200us, false);
+	statistics.record(Transaction::EraseTrajectories, 2ms, false);
+
+	ASSERT_EQUAL(2, statistics[Transaction::GetCartesianPosition].latencies.count());
+	ASSERT_EQUAL(1, statistics[Transaction::EraseTrajectories].latencies.count());
+	ASSERT_EQUAL(0, statistics[Transaction::GetStatus].latencies.count());
+
+	auto const mean = statistics[Transaction::GetCartesianPosition].latencies.mean();
+	ASSERT_EQUAL(1000, std::chrono::duration_cast<std::chrono::microseconds>(mean).count());
+}
+
+void testFailedTransactionsAreCountedAsErrors() {
+	auto statistics = TransactionStatistics{};
+	statistics.record(Transaction::GetStatus, 1ms, true);
+	statistics.record(Transaction::GetStatus, 1ms, false);
+
+	ASSERT_EQUAL(2, statistics[Transaction::GetStatus].latencies.count());
+	ASSERT_EQUAL(1, statistics[Transaction::GetStatus].errors);
+}
+
+void testTotalTimeSumsAllKinds() {
+	auto statistics = TransactionStatistics{};
+	statistics.record(Transaction::GetAngularCurrent, 1ms, false);
+	statistics.record(Transaction::GetAngularVelocity, 2ms, false);
+
+	ASSERT_EQUAL(3, std::chrono::duration_cast<std::chrono::milliseconds>(statistics.totalTime()).count());
+}
+
+void testSummaryOnlyListsPerformedTransactions() {
+	auto statistics = TransactionStatistics{};
+	ASSERT_EQUAL("no transactions", KinovaZED::toString(statistics));
+
+	statistics.record(Transaction::ReleaseJoystick, 1ms, false);
+	auto const summary = KinovaZED::toString(statistics);
+
+	ASSERT(summary.find("release_joystick: 1 calls, 0 errors") != std::string::npos);
+	ASSERT(summary.find("get_cart_pos") == std::string::npos);
+}
+
+cute::suite make_suite_TransactionStatisticsSuite() {
+	cute::suite s{};
+	s.push_back(CUTE(testTransactionsAreCountedPerKind));
+	s.push_back(CUTE(testFailedTransactionsAreCountedAsErrors));
+	s.push_back(CUTE(testTotalTimeSumsAllKinds));
+	s.push_back(CUTE(testSummaryOnlyListsPerformedTransactions));
+	return s;
+}